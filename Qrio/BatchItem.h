@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_BATCHITEM_H
+#define QR_IO_BATCHITEM_H
+
+#include <string>
+
+#include "Ecl.h"
+
+
+namespace Qrio {
+    /*
+     * BatchItem: 1.0
+     *
+     * One payload of a batch job, parsed from a line of its input.
+     */
+    class BatchItem final {
+    public:
+        /* Line number of the item in the input, from 1 */
+        size_t line{0};
+
+        /* Name of the outputs of the item, the line number unless the input gives one */
+        std::string key{};
+
+        /* Data string of the QR code (0x5C values doubled) */
+        std::wstring data{};
+
+        /* Error correction level of the QR code */
+        Ecl ecl{Ecl::M};
+    };
+}
+
+
+#endif //QR_IO_BATCHITEM_H
@@ -0,0 +1,607 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "BatchJob.h"
+
+
+namespace Qrio {
+    using std::string, std::string_view, std::wstring, std::vector, std::optional, std::pair, std::future,
+            std::async, std::launch, std::thread, std::min, std::max, std::getline, std::to_string,
+            std::ifstream, std::ofstream, std::exception, std::invalid_argument, std::domain_error;
+    using std::chrono::steady_clock, std::chrono::duration;
+    using std::filesystem::rename;
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of QR codes written per second.
+     */
+    double BatchJob::Stats::getItemsPerSecond() const {
+        return seconds > 0 ? static_cast<double>(items) / seconds : 0;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Input stream of lines, which must outlive the job,
+     *      optional batch options.
+     *
+     * Post-Conditions:
+     *      Job reading the input from its current position.
+     *      Throws an invalid argument exception if the block size is 0.
+     */
+    BatchJob::BatchJob(std::istream& input, const BatchOptions& options) : input{input}, options{options} {
+        if (options.block_size == 0) {
+            throw invalid_argument("Batch block size must be positive");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of lines done according to the checkpoint file, 0 without one.
+     *      Throws an invalid argument exception if the checkpoint file is not one.
+     */
+    size_t BatchJob::getCheckpoint() const {
+        if (options.checkpoint.empty()) {
+            return 0;
+        }
+
+        ifstream file{options.checkpoint};
+
+        if (not file) {
+            return 0;
+        }
+
+        string header{};
+        size_t result{0};
+
+        if (not getline(file, header) or header != "QRIO_BATCH 1" or not (file >> result)) {
+            throw invalid_argument("Not a batch checkpoint: " + options.checkpoint);
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Sink of the QR codes (write is required).
+     *
+     * Post-Conditions:
+     *      Skips the lines done according to the checkpoint, then generates the rest.
+     *      Lines which cannot be parsed or encoded are reported in the statistics & skipped.
+     *      Returns the statistics of the run.
+     *
+     * The checkpoint is only moved after the sink is flushed, so the lines it counts are durable.
+     * Lines written after the last checkpoint are written again on resume.
+     */
+    BatchJob::Stats BatchJob::run(const BatchSink& sink) {
+        const auto start{steady_clock::now()};
+        const size_t workers{static_cast<size_t>(
+                options.threads > 0 ? options.threads : max(1u, thread::hardware_concurrency()))};
+
+        Stats result{};
+        size_t line{0};
+        string text{};
+
+        const size_t done{getCheckpoint()};
+
+        while (line < done and getline(input, text)) {
+            line++;
+        }
+
+        result.skipped = line;
+
+        size_t checkpointed{line};
+        vector<BatchItem> items{};
+        vector<optional<QrCode>> codes{};
+        vector<vector<uint8_t>> outputs{};
+        vector<string> failures{};
+
+        while (input) {
+            auto time{steady_clock::now()};
+
+            items.clear();
+
+            while (items.size() < options.block_size and getline(input, text)) {
+                line++;
+                result.lines++;
+
+                if (text.find_first_not_of(" \t\r") == string::npos) {
+                    continue;
+                }
+
+                try {
+                    items.push_back(parseLine(text, line, options.ecl));
+                } catch (const invalid_argument& error) {
+                    result.errors.push_back("line " + to_string(line) + ": " + error.what());
+                }
+            }
+
+            result.read_seconds += duration<double>(steady_clock::now() - time).count();
+
+            const size_t N{items.size()};
+
+            codes.clear();
+            codes.resize(N);
+            outputs.assign(N, vector<uint8_t>{});
+            failures.assign(N, string{});
+
+            vector<future<pair<double, double>>> parts{};
+
+            for (size_t t{0}; t < min(workers, N); t++) {
+                parts.push_back(async(launch::async, [&, t]() {
+                    double encode{0}, render{0};
+
+                    for (size_t i{t}; i < N; i += workers) {
+                        try {
+                            const auto encode_start{steady_clock::now()};
+
+                            codes[i].emplace(items[i].data, items[i].ecl, Designator::TERMINATOR,
+                                             -1, -1, 0, -1, -1, options.mask_policy);
+
+                            const auto render_start{steady_clock::now()};
+
+                            if (sink.render) {
+                                outputs[i] = sink.render(*codes[i]);
+                            }
+
+                            encode += duration<double>(render_start - encode_start).count();
+                            render += duration<double>(steady_clock::now() - render_start).count();
+                        } catch (const exception& error) {
+                            codes[i].reset();
+                            failures[i] = error.what();
+                        }
+                    }
+
+                    return pair<double, double>{encode, render};
+                }));
+            }
+
+            for (future<pair<double, double>>& part: parts) {
+                const auto [encode, render]{part.get()};
+
+                result.encode_seconds += encode;
+                result.render_seconds += render;
+            }
+
+            time = steady_clock::now();
+
+            for (size_t i{0}; i < N; i++) {
+                if (codes[i]) {
+                    sink.write(items[i], *codes[i], outputs[i]);
+                    result.items++;
+                } else {
+                    result.errors.push_back("line " + to_string(items[i].line) + ": " + failures[i]);
+                }
+            }
+
+            if (not options.checkpoint.empty() and line - checkpointed >= options.checkpoint_interval) {
+                if (sink.flush) {
+                    sink.flush();
+                }
+
+                setCheckpoint(line);
+                checkpointed = line;
+            }
+
+            result.write_seconds += duration<double>(steady_clock::now() - time).count();
+        }
+
+        const auto time{steady_clock::now()};
+
+        if (sink.flush) {
+            sink.flush();
+        }
+
+        if (not options.checkpoint.empty() and line > checkpointed) {
+            setCheckpoint(line);
+        }
+
+        result.write_seconds += duration<double>(steady_clock::now() - time).count();
+        result.seconds = duration<double>(steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Line of the input,
+     *      line number,
+     *      error correction level when the line does not give one.
+     *
+     * Post-Conditions:
+     *      Returns the item of the line.
+     *      Throws an invalid argument exception if the line is not valid UTF-8,
+     *      or is a malformed or unsupported JSON object.
+     *
+     * Plain text lines are taken whole (without a trailing carriage return).
+     * Unknown members of JSON objects are ignored, nested values are not supported.
+     */
+    BatchItem BatchJob::parseLine(string_view text, size_t line, Ecl ecl) {
+        if (not text.empty() and text.back() == '\r') {
+            text.remove_suffix(1);
+        }
+
+        BatchItem result{line, to_string(line), wstring{}, ecl};
+        size_t position{text.find_first_not_of(" \t")};
+
+        if (position == string_view::npos or text[position] != '{') {
+            result.data = toData(text);
+
+            return result;
+        }
+
+        const auto skip{[&]() {
+            while (position < text.size() and (text[position] == ' ' or text[position] == '\t')) {
+                position++;
+            }
+        }};
+
+        const auto expect{[&](char c) {
+            skip();
+
+            if (position >= text.size() or text[position] != c) {
+                throw invalid_argument(string{"Malformed JSON object, expected '"} + c + "'");
+            }
+        }};
+
+        bool has_data{false};
+
+        position++;
+
+        while (true) {
+            expect('"');
+
+            const string name{parseString(text, position)};
+
+            expect(':');
+            position++;
+            skip();
+
+            string value{};
+
+            if (position < text.size() and text[position] == '"') {
+                value = parseString(text, position);
+            } else if (position < text.size() and (text[position] == '{' or text[position] == '[')) {
+                throw invalid_argument("Nested JSON values are not supported");
+            } else {
+                const size_t end{min(text.find_first_of(",} \t", position), text.size())};
+
+                value = text.substr(position, end - position);
+                position = end;
+
+                if (value.empty()) {
+                    throw invalid_argument("Malformed JSON object, missing value");
+                }
+            }
+
+            if (name == "id") {
+                result.key = value;
+            } else if (name == "data") {
+                result.data = toData(value);
+                has_data = true;
+            } else if (name == "ecl") {
+                const string LEVELS{"LMQHlmqh"};
+                const Ecl ECLS[]{Ecl::L, Ecl::M, Ecl::Q, Ecl::H};
+
+                if (value.size() != 1 or LEVELS.find(value[0]) == string::npos) {
+                    throw invalid_argument("Unknown ECL: " + value);
+                }
+
+                result.ecl = ECLS[LEVELS.find(value[0]) % 4];
+            }
+
+            skip();
+
+            if (position < text.size() and text[position] == ',') {
+                position++;
+                continue;
+            }
+
+            expect('}');
+            position++;
+            skip();
+
+            if (position != text.size()) {
+                throw invalid_argument("Malformed JSON object, trailing characters");
+            }
+
+            break;
+        }
+
+        if (not has_data) {
+            throw invalid_argument("Missing data member");
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      UTF-8 text.
+     *
+     * Post-Conditions:
+     *      Returns the code points of the text, with the 0x5C values doubled.
+     *      Throws an invalid argument exception if the text is not valid UTF-8.
+     */
+    wstring BatchJob::toData(string_view text) {
+        wstring result{};
+
+        result.reserve(text.size());
+
+        for (size_t i{0}; i < text.size();) {
+            const auto lead{static_cast<uint8_t>(text[i])};
+            const size_t length{lead < 0x80 ? 1u : lead >= 0xC2 and lead < 0xE0 ? 2u
+                                : lead >= 0xE0 and lead < 0xF0 ? 3u : lead >= 0xF0 and lead < 0xF5 ? 4u : 0u};
+
+            if (length == 0 or i + length > text.size()) {
+                throw invalid_argument("Invalid UTF-8 text");
+            }
+
+            uint32_t code{length == 1 ? lead : lead & (0x7Fu >> length)};
+
+            for (size_t j{1}; j < length; j++) {
+                const auto next{static_cast<uint8_t>(text[i + j])};
+
+                if ((next & 0xC0) != 0x80) {
+                    throw invalid_argument("Invalid UTF-8 text");
+                }
+
+                code = code << 6 | (next & 0x3F);
+            }
+
+            /* Overlong forms, surrogates & values beyond Unicode */
+            if ((length == 3 and code < 0x800) or (length == 4 and (code < 0x10000 or code > 0x10FFFF))
+                or (code >= 0xD800 and code < 0xE000)) {
+                throw invalid_argument("Invalid UTF-8 text");
+            }
+
+            result += static_cast<wchar_t>(code);
+
+            if (code == 0x5C) {
+                result += L'\\';
+            }
+
+            i += length;
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Number of lines done.
+     *
+     * Post-Conditions:
+     *      Replaces the checkpoint file atomically, once its bytes reached the disk.
+     *      Throws an invalid argument exception if the file cannot be created,
+     *      or a domain error exception if it cannot be written.
+     */
+    void BatchJob::setCheckpoint(size_t lines) const {
+        const string temporary{options.checkpoint + ".tmp"};
+
+        {
+            ofstream file{temporary, std::ios::trunc};
+
+            if (not file) {
+                throw invalid_argument("Cannot create checkpoint file: " + temporary);
+            }
+
+            file << "QRIO_BATCH 1\n" << lines << '\n';
+            file.close();
+
+            if (not file) {
+                throw domain_error("Checkpoint file could not be written");
+            }
+        }
+
+        /* Without it a crash after the rename can leave an empty checkpoint */
+        syncFile(temporary);
+        rename(temporary, options.checkpoint);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Path of a written file.
+     *
+     * Post-Conditions:
+     *      Flushes the file to the disk.
+     *      Throws a domain error exception if it fails.
+     */
+    void BatchJob::syncFile(const string& path) {
+#ifdef _WIN32
+        const int file{_open(path.c_str(), _O_RDWR | _O_BINARY)};
+        const bool synced{file >= 0 and _commit(file) == 0};
+
+        if (file >= 0) {
+            _close(file);
+        }
+#else
+        const int file{open(path.c_str(), O_WRONLY)};
+        const bool synced{file >= 0 and fsync(file) == 0};
+
+        if (file >= 0) {
+            close(file);
+        }
+#endif
+
+        if (not synced) {
+            throw domain_error("Checkpoint file could not be written");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      JSON text,
+     *      position of the opening quote.
+     *
+     * Post-Conditions:
+     *      Returns the UTF-8 value of the string & moves the position past its closing quote.
+     *      Throws an invalid argument exception if the string is malformed.
+     */
+    string BatchJob::parseString(string_view text, size_t& position) {
+        string result{};
+
+        const auto append{[&result](uint32_t code) {
+            if (code < 0x80) {
+                result += static_cast<char>(code);
+            } else if (code < 0x800) {
+                result += static_cast<char>(0xC0 | code >> 6);
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            } else if (code < 0x10000) {
+                result += static_cast<char>(0xE0 | code >> 12);
+                result += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            } else {
+                result += static_cast<char>(0xF0 | code >> 18);
+                result += static_cast<char>(0x80 | (code >> 12 & 0x3F));
+                result += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+                result += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }};
+
+        const auto getHex{[&text, &position]() {
+            if (position + 4 > text.size()) {
+                throw invalid_argument("Malformed JSON escape");
+            }
+
+            uint32_t code{0};
+
+            for (size_t i{0}; i < 4; i++) {
+                const char c{text[position++]};
+                const string_view DIGITS{"0123456789abcdef"};
+                const size_t digit{DIGITS.find(static_cast<char>(c | 0x20))};
+
+                if (digit == string_view::npos) {
+                    throw invalid_argument("Malformed JSON escape");
+                }
+
+                code = code << 4 | static_cast<uint32_t>(digit);
+            }
+
+            return code;
+        }};
+
+        position++;
+
+        while (true) {
+            if (position >= text.size()) {
+                throw invalid_argument("Unterminated JSON string");
+            }
+
+            const char c{text[position++]};
+
+            if (c == '"') {
+                return result;
+            }
+
+            if (static_cast<uint8_t>(c) < 0x20) {
+                throw invalid_argument("Control character in JSON string");
+            }
+
+            if (c != '\\') {
+                result += c;
+                continue;
+            }
+
+            if (position >= text.size()) {
+                throw invalid_argument("Unterminated JSON string");
+            }
+
+            switch (text[position++]) {
+                case '"':
+                    result += '"';
+                    break;
+                case '\\':
+                    result += '\\';
+                    break;
+                case '/':
+                    result += '/';
+                    break;
+                case 'b':
+                    result += '\b';
+                    break;
+                case 'f':
+                    result += '\f';
+                    break;
+                case 'n':
+                    result += '\n';
+                    break;
+                case 'r':
+                    result += '\r';
+                    break;
+                case 't':
+                    result += '\t';
+                    break;
+                case 'u': {
+                    uint32_t code{getHex()};
+
+                    /* Surrogate pair */
+                    if (code >= 0xD800 and code < 0xDC00 and text.substr(position, 2) == "\\u") {
+                        position += 2;
+
+                        const uint32_t low{getHex()};
+
+                        if (low < 0xDC00 or low >= 0xE000) {
+                            throw invalid_argument("Malformed JSON surrogate pair");
+                        }
+
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    } else if (code >= 0xD800 and code < 0xE000) {
+                        throw invalid_argument("Malformed JSON surrogate pair");
+                    }
+
+                    append(code);
+                    break;
+                }
+                default:
+                    throw invalid_argument("Malformed JSON escape");
+            }
+        }
+    }
+}
@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_BATCHJOB_H
+#define QR_IO_BATCHJOB_H
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BatchItem.h"
+#include "BatchOptions.h"
+#include "BatchSink.h"
+
+
+namespace Qrio {
+    /*
+     * BatchJob: 1.0
+     *
+     * Generates the QR codes of a stream of payloads, one per line: either plain text
+     * or an NDJSON object {"id": "...", "data": "...", "ecl": "L|M|Q|H"} (only data is required).
+     * Blocks of lines are encoded & rendered in parallel, then written in input order.
+     * With a checkpoint file, the number of lines done is saved after the sink is flushed,
+     * so a job stopped at any point resumes without redoing the lines already written.
+     */
+    class BatchJob final {
+    public:
+        /*
+         * Statistics of a batch run.
+         */
+        class Stats final {
+        public:
+            /* Number of lines read, excluding the ones skipped */
+            size_t lines{0};
+
+            /* Number of QR codes written */
+            size_t items{0};
+
+            /* Number of lines skipped thanks to the checkpoint */
+            size_t skipped{0};
+
+            /* Errors of the lines which could not be parsed or encoded, as "line n: message" */
+            std::vector<std::string> errors{};
+
+            /* Wall clock time reading & parsing the input */
+            double read_seconds{0};
+
+            /* Worker time encoding, summed over the threads */
+            double encode_seconds{0};
+
+            /* Worker time rendering, summed over the threads */
+            double render_seconds{0};
+
+            /* Wall clock time writing to the sink & checkpointing */
+            double write_seconds{0};
+
+            /* Wall clock time of the whole run */
+            double seconds{0};
+
+            /*
+             * Pre-Conditions:
+             *      None.
+             *
+             * Post-Conditions:
+             *      Returns the number of QR codes written per second.
+             */
+            [[nodiscard]] double getItemsPerSecond() const;
+        };
+
+        /*
+         * Pre-Conditions:
+         *      Input stream of lines, which must outlive the job,
+         *      optional batch options.
+         *
+         * Post-Conditions:
+         *      Job reading the input from its current position.
+         *      Throws an invalid argument exception if the block size is 0.
+         */
+        explicit BatchJob(std::istream&, const BatchOptions& options = BatchOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of lines done according to the checkpoint file, 0 without one.
+         *      Throws an invalid argument exception if the checkpoint file is not one.
+         */
+        [[nodiscard]] size_t getCheckpoint() const;
+
+        /*
+         * Pre-Conditions:
+         *      Sink of the QR codes (write is required).
+         *
+         * Post-Conditions:
+         *      Skips the lines done according to the checkpoint, then generates the rest.
+         *      Lines which cannot be parsed or encoded are reported in the statistics & skipped.
+         *      Returns the statistics of the run.
+         */
+        Stats run(const BatchSink&);
+
+        /*
+         * Pre-Conditions:
+         *      Line of the input,
+         *      line number,
+         *      error correction level when the line does not give one.
+         *
+         * Post-Conditions:
+         *      Returns the item of the line.
+         *      Throws an invalid argument exception if the line is not valid UTF-8,
+         *      or is a malformed or unsupported JSON object.
+         */
+        [[nodiscard]] static BatchItem parseLine(std::string_view, size_t, Ecl);
+
+        /*
+         * Pre-Conditions:
+         *      UTF-8 text.
+         *
+         * Post-Conditions:
+         *      Returns the code points of the text, with the 0x5C values doubled.
+         *      Throws an invalid argument exception if the text is not valid UTF-8.
+         */
+        [[nodiscard]] static std::wstring toData(std::string_view);
+
+    private:
+        std::istream& input;
+
+        BatchOptions options;
+
+        /*
+         * Pre-Conditions:
+         *      Number of lines done.
+         *
+         * Post-Conditions:
+         *      Replaces the checkpoint file atomically, once its bytes reached the disk.
+         *      Throws an invalid argument exception if the file cannot be created,
+         *      or a domain error exception if it cannot be written.
+         */
+        void setCheckpoint(size_t) const;
+
+        /*
+         * Pre-Conditions:
+         *      Path of a written file.
+         *
+         * Post-Conditions:
+         *      Flushes the file to the disk.
+         *      Throws a domain error exception if it fails.
+         */
+        static void syncFile(const std::string&);
+
+        /*
+         * Pre-Conditions:
+         *      JSON text,
+         *      position of the opening quote.
+         *
+         * Post-Conditions:
+         *      Returns the UTF-8 value of the string & moves the position past its closing quote.
+         *      Throws an invalid argument exception if the string is malformed.
+         */
+        [[nodiscard]] static std::string parseString(std::string_view, size_t&);
+    };
+}
+
+
+#endif //QR_IO_BATCHJOB_H
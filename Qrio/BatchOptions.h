@@ -0,0 +1,63 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_BATCHOPTIONS_H
+#define QR_IO_BATCHOPTIONS_H
+
+#include <cstddef>
+#include <string>
+
+#include "Ecl.h"
+#include "MaskPolicy.h"
+
+
+namespace Qrio {
+    /*
+     * BatchOptions: 1.0
+     *
+     * Describes how a batch job shares its work & records its progress.
+     */
+    class BatchOptions final {
+    public:
+        /* Number of worker threads, 0 for the hardware concurrency */
+        int threads{0};
+
+        /* Input lines encoded in parallel before their outputs are written in order */
+        size_t block_size{1024};
+
+        /* Path of the checkpoint file, empty for none */
+        std::string checkpoint{};
+
+        /* Input lines between two checkpoints, rounded up to whole blocks */
+        size_t checkpoint_interval{10'000};
+
+        /* Error correction level of the lines which do not give one */
+        Ecl ecl{Ecl::M};
+
+        /* Mask selection of all the QR codes */
+        MaskPolicy mask_policy{MaskPolicy::FAST};
+    };
+}
+
+
+#endif //QR_IO_BATCHOPTIONS_H
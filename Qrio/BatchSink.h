@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_BATCHSINK_H
+#define QR_IO_BATCHSINK_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "BatchItem.h"
+#include "QrCode.h"
+
+
+namespace Qrio {
+    /*
+     * BatchSink: 1.0
+     *
+     * Destination of the QR codes of a batch job (image files, pack file, standard output, ...).
+     */
+    class BatchSink final {
+    public:
+        /* Output bytes of a QR code, called on the worker threads, empty for none */
+        std::function<std::vector<uint8_t>(const QrCode&)> render{};
+
+        /* Stores an item, its QR code & its output bytes, called in input order on the calling thread */
+        std::function<void(const BatchItem&, const QrCode&, const std::vector<uint8_t>&)> write{};
+
+        /* Makes the stored items durable before a checkpoint, empty if there is nothing to do */
+        std::function<void()> flush{};
+    };
+}
+
+
+#endif //QR_IO_BATCHSINK_H
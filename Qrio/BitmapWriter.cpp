@@ -0,0 +1,1160 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef QRIO_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#include "BitmapWriter.h"
+
+
+namespace Qrio {
+    using std::array, std::domain_error, std::invalid_argument, std::length_error, std::memcpy, std::memset,
+            std::min, std::ostream, std::ostringstream, std::string, std::to_string, std::vector;
+
+    /*
+     * IdatStream: 1.0
+     *
+     * Compresses PNG image data incrementally & writes it to a stream
+     * as a sequence of IDAT chunks, so the whole image never has to be in memory.
+     * Without zlib the data is split into stored deflate blocks.
+     */
+    class BitmapWriter::IdatStream final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Output stream,
+         *      zlib compression level in [0, 9] (-1 for the default),
+         *      zlib compression strategy.
+         *
+         * Post-Conditions:
+         *      Starts the zlib stream (RFC 1950).
+         *      Throws a domain error if the level or the strategy is invalid.
+         */
+        IdatStream(ostream& output, int compression, PngStrategy strategy) : output{output} {
+#ifdef QRIO_WITH_ZLIB
+            if (deflateInit2(&stream, compression, Z_DEFLATED, MAX_WBITS, 8,
+                             static_cast<int>(strategy)) != Z_OK) {
+                throw domain_error("Invalid PNG compression level or strategy");
+            }
+#else
+            static_cast<void>(compression);
+            static_cast<void>(strategy);
+
+            /* Deflate with a 32K window, no preset dictionary, fastest level */
+            chunk.insert(chunk.end(), {0x78, 0x01});
+#endif
+        }
+
+        IdatStream(const IdatStream&) = delete;
+
+        IdatStream& operator=(const IdatStream&) = delete;
+
+        ~IdatStream() {
+#ifdef QRIO_WITH_ZLIB
+            deflateEnd(&stream);
+#endif
+        }
+
+        /*
+         * Pre-Conditions:
+         *      Raw bytes,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Compresses the bytes, full chunks are written to the output.
+         *      Throws a domain error if the compression fails.
+         */
+        void write(const uint8_t* data, size_t size) {
+#ifdef QRIO_WITH_ZLIB
+            stream.next_in = const_cast<Bytef*>(data);
+            stream.avail_in = static_cast<uInt>(size);
+
+            while (stream.avail_in != 0) {
+                deflateInto(Z_NO_FLUSH);
+            }
+#else
+            for (size_t i{0}; i < size; i++) {
+                a = (a + data[i]) % 65'521;
+                b = (b + a) % 65'521;
+            }
+
+            while (size != 0) {
+                const size_t length{min(size, MAX_STORED - pending.size())};
+
+                pending.insert(pending.end(), data, data + length);
+                data += length;
+                size -= length;
+
+                if (pending.size() == MAX_STORED) {
+                    storeBlock(false);
+                }
+            }
+#endif
+        }
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Ends the zlib stream & writes the remaining chunk.
+         *      Throws a domain error if the compression fails.
+         */
+        void finish() {
+#ifdef QRIO_WITH_ZLIB
+            stream.next_in = nullptr;
+            stream.avail_in = 0;
+
+            while (deflateInto(Z_FINISH) != Z_STREAM_END) {}
+#else
+            storeBlock(true);
+
+            /* Adler-32 checksum of the raw bytes */
+            appendBigEndian(chunk, b << 16 | a, 4);
+#endif
+            flush();
+        }
+
+    private:
+        /* Size of the IDAT chunks */
+        const static size_t CHUNK_SIZE{1 << 16};
+
+        ostream& output;
+
+        /* Compressed bytes of the current chunk */
+        std::vector<uint8_t> chunk{};
+
+#ifdef QRIO_WITH_ZLIB
+        z_stream stream{};
+
+        /*
+         * Pre-Conditions:
+         *      Zlib flush mode.
+         *
+         * Post-Conditions:
+         *      Runs deflate once into the free space of the chunk, writing the chunk when it is full.
+         *      Returns the zlib status.
+         *      Throws a domain error if the compression fails.
+         */
+        int deflateInto(int flush_mode) {
+            const size_t used{chunk.size()};
+
+            chunk.resize(CHUNK_SIZE);
+
+            stream.next_out = chunk.data() + used;
+            stream.avail_out = static_cast<uInt>(CHUNK_SIZE - used);
+
+            const int status{deflate(&stream, flush_mode)};
+
+            chunk.resize(CHUNK_SIZE - stream.avail_out);
+
+            if (status != Z_OK and status != Z_STREAM_END and status != Z_BUF_ERROR) {
+                throw domain_error("PNG compression failed");
+            }
+
+            if (chunk.size() == CHUNK_SIZE) {
+                flush();
+            }
+
+            return status;
+        }
+#else
+        /* Maximum length of a stored block */
+        const static size_t MAX_STORED{65'535};
+
+        /* Raw bytes of the current stored block */
+        std::vector<uint8_t> pending{};
+
+        /* Adler-32 sums */
+        uint32_t a{1}, b{0};
+
+        /*
+         * Pre-Conditions:
+         *      Whether the block is the last one.
+         *
+         * Post-Conditions:
+         *      Appends the pending bytes as a stored block (RFC 1951 3.2.4),
+         *      writing the chunk when it is full.
+         */
+        void storeBlock(bool last) {
+            chunk.push_back(last ? 1 : 0);
+            appendLittleEndian(chunk, static_cast<uint32_t>(pending.size()), 2);
+            appendLittleEndian(chunk, static_cast<uint32_t>(~pending.size() & 0xFFFF), 2);
+            chunk.insert(chunk.end(), pending.begin(), pending.end());
+            pending.clear();
+
+            if (chunk.size() >= CHUNK_SIZE) {
+                flush();
+            }
+        }
+#endif
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Writes the compressed bytes as an IDAT chunk, if there are any.
+         */
+        void flush() {
+            if (chunk.empty()) {
+                return;
+            }
+
+            vector<uint8_t> bytes{};
+
+            appendChunk(bytes, "IDAT", chunk);
+            output.write(reinterpret_cast<const char*>(bytes.data()),
+                         static_cast<std::streamsize>(bytes.size()));
+            chunk.clear();
+        }
+    };
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8).
+     *
+     * Post-Conditions:
+     *      Returns a binary portable bitmap (P4), dark modules are black.
+     */
+    vector<uint8_t> BitmapWriter::toPbm(const SquareMatrix& matrix, int scale, int border_width) {
+        const size_t side{(matrix.size() + 2 * border_width) * scale};
+        const vector<vector<uint8_t>> lines{getScanlines(matrix, scale, border_width, true)};
+        const string header{"P4\n" + to_string(side) + " " + to_string(side) + "\n"};
+
+        vector<uint8_t> result{header.begin(), header.end()};
+
+        result.reserve(header.size() + side * lines.back().size());
+
+        for (size_t y{0}; y < side; y++) {
+            const vector<uint8_t>& line{getScanline(lines, y, scale, border_width)};
+
+            result.insert(result.end(), line.begin(), line.end());
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black),
+     *      optional zlib compression level in [0, 9] (-1 for the default),
+     *      optional zlib compression strategy.
+     *
+     * Post-Conditions:
+     *      Returns a 1 bit PNG, grayscale for black on white, otherwise with a palette.
+     *      Throws a domain error if the compression fails.
+     */
+    vector<uint8_t> BitmapWriter::toPng(const SquareMatrix& matrix,
+                                        int scale,
+                                        int border_width,
+                                        uint32_t light_color,
+                                        uint32_t dark_color,
+                                        int compression,
+                                        PngStrategy strategy) {
+        ostringstream output{};
+
+        writePng(output, matrix, scale, border_width, light_color, dark_color, compression, strategy);
+
+        const string bytes{output.str()};
+
+        return {bytes.begin(), bytes.end()};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output stream (opened in binary mode for files),
+     *      row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black),
+     *      optional zlib compression level in [0, 9] (-1 for the default),
+     *      optional zlib compression strategy.
+     *
+     * Post-Conditions:
+     *      Streams a 1 bit PNG, grayscale for black on white, otherwise with a palette,
+     *      one module row at a time: the row is packed once & fed to zlib for each
+     *      of its pixel rows, compressed data leaves in 64 KiB IDAT chunks.
+     *      Throws a domain error if the compression fails.
+     *
+     * Every row uses filter type 0 (None), the other filters do not help 1 bit images.
+     * Without zlib the image data is stored uncompressed.
+     */
+    void BitmapWriter::writePng(ostream& output,
+                                const SquareMatrix& matrix,
+                                int scale,
+                                int border_width,
+                                uint32_t light_color,
+                                uint32_t dark_color,
+                                int compression,
+                                PngStrategy strategy) {
+        const static uint8_t SIGNATURE[8]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+
+        /* Grayscale stores black as 0, the palette stores the dark color at index 1 */
+        const bool grayscale{light_color == 0xFFFFFF and dark_color == 0x000000};
+
+        vector<uint8_t> result{SIGNATURE, SIGNATURE + sizeof(SIGNATURE)}, header{};
+
+        appendBigEndian(header, side, 4);
+        appendBigEndian(header, side, 4);
+
+        /* Bit depth 1, color type 0 or 3, deflate, adaptive filtering, no interlace */
+        header.insert(header.end(), {1, static_cast<uint8_t>(grayscale ? 0 : 3), 0, 0, 0});
+        appendChunk(result, "IHDR", header);
+
+        if (not grayscale) {
+            vector<uint8_t> palette{};
+
+            appendBigEndian(palette, light_color, 3);
+            appendBigEndian(palette, dark_color, 3);
+            appendChunk(result, "PLTE", palette);
+        }
+
+        output.write(reinterpret_cast<const char*>(result.data()), static_cast<std::streamsize>(result.size()));
+
+        /* Filter type 0 (None) byte, then the scanline */
+        vector<uint8_t> quiet(1 + (side + 7) / 8, 0), line(quiet.size(), 0);
+
+        packRow(matrix, S, scale, border_width, not grayscale, quiet.data() + 1);
+
+        IdatStream stream{output, compression, strategy};
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool is_quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            if (not is_quiet) {
+                packRow(matrix, i - border_width, scale, border_width, not grayscale, line.data() + 1);
+            }
+
+            for (int k{0}; k < scale; k++) {
+                stream.write((is_quiet ? quiet : line).data(), line.size());
+            }
+        }
+
+        stream.finish();
+
+        result.clear();
+        appendChunk(result, "IEND", {});
+        output.write(reinterpret_cast<const char*>(result.data()), static_cast<std::streamsize>(result.size()));
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black).
+     *
+     * Post-Conditions:
+     *      Returns an uncompressed 1 bit TIFF, bilevel for black on white,
+     *      otherwise with a two color palette.
+     *      Throws a length error if the image exceeds 4 GiB.
+     */
+    vector<uint8_t> BitmapWriter::toTiff(const SquareMatrix& matrix,
+                                         int scale,
+                                         int border_width,
+                                         uint32_t light_color,
+                                         uint32_t dark_color) {
+        ostringstream output{};
+
+        writeTiff(output, matrix, scale, border_width, light_color, dark_color);
+
+        const string bytes{output.str()};
+
+        return {bytes.begin(), bytes.end()};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output stream (opened in binary mode for files),
+     *      row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black).
+     *
+     * Post-Conditions:
+     *      Streams an uncompressed 1 bit little endian baseline TIFF (TIFF 6.0),
+     *      bilevel (WhiteIsZero) for black on white, otherwise with a two color palette.
+     *      The header, the IFD & its values precede the single strip,
+     *      whose size is known up front, so each module row is packed once & written scale times.
+     *      Throws a length error if the image exceeds 4 GiB.
+     */
+    void BitmapWriter::writeTiff(ostream& output,
+                                 const SquareMatrix& matrix,
+                                 int scale,
+                                 int border_width,
+                                 uint32_t light_color,
+                                 uint32_t dark_color) {
+        /* Field types */
+        const static uint32_t SHORT{3}, LONG{4}, RATIONAL{5};
+
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const size_t stride{(side + 7) / 8};
+        const bool bilevel{light_color == 0xFFFFFF and dark_color == 0x000000};
+
+        /* Header, entry count, entries, next IFD offset, then the resolutions & the color map */
+        const uint32_t entries{bilevel ? 11u : 12u};
+        const uint32_t resolution{8 + 2 + entries * 12 + 4};
+        const uint32_t color_map{resolution + 16};
+        const uint32_t strip{color_map + (bilevel ? 0 : 12)};
+
+        if (stride * side > 0xFFFFFFFFull - strip) {
+            throw length_error("TIFF images are limited to 4 GiB");
+        }
+
+        vector<uint8_t> result{'I', 'I'};
+
+        appendLittleEndian(result, 42, 2);
+        appendLittleEndian(result, 8, 4);
+        appendLittleEndian(result, entries, 2);
+
+        const auto add_entry{[&result](uint32_t tag, uint32_t type, uint32_t count, uint32_t value) {
+            appendLittleEndian(result, tag, 2);
+            appendLittleEndian(result, type, 2);
+            appendLittleEndian(result, count, 4);
+            appendLittleEndian(result, value, 4);
+        }};
+
+        /* Entries sorted by tag, SHORT values are left justified */
+        add_entry(256, LONG, 1, static_cast<uint32_t>(side));
+        add_entry(257, LONG, 1, static_cast<uint32_t>(side));
+        add_entry(258, SHORT, 1, 1);
+        add_entry(259, SHORT, 1, 1);
+        add_entry(262, SHORT, 1, bilevel ? 0 : 3);
+        add_entry(273, LONG, 1, strip);
+        add_entry(277, SHORT, 1, 1);
+        add_entry(278, LONG, 1, static_cast<uint32_t>(side));
+        add_entry(279, LONG, 1, static_cast<uint32_t>(stride * side));
+        add_entry(282, RATIONAL, 1, resolution);
+        add_entry(283, RATIONAL, 1, resolution + 8);
+
+        if (not bilevel) {
+            add_entry(320, SHORT, 6, color_map);
+        }
+
+        appendLittleEndian(result, 0, 4);
+
+        /* 72 DPI, the resolution unit defaults to inches */
+        for (int k{0}; k < 2; k++) {
+            appendLittleEndian(result, 72, 4);
+            appendLittleEndian(result, 1, 4);
+        }
+
+        /* 16 bit color map, all reds, then all greens, then all blues */
+        for (int shift{16}; not bilevel and shift >= 0; shift -= 8) {
+            appendLittleEndian(result, ((light_color >> shift) & 0xFF) * 257, 2);
+            appendLittleEndian(result, ((dark_color >> shift) & 0xFF) * 257, 2);
+        }
+
+        output.write(reinterpret_cast<const char*>(result.data()), static_cast<std::streamsize>(result.size()));
+
+        /* WhiteIsZero & the palette both store the dark modules as 1 */
+        vector<uint8_t> quiet(stride, 0), line(stride, 0);
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool is_quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            if (not is_quiet) {
+                packRow(matrix, i - border_width, scale, border_width, true, line.data());
+            }
+
+            for (int k{0}; k < scale; k++) {
+                output.write(reinterpret_cast<const char*>((is_quiet ? quiet : line).data()),
+                             static_cast<std::streamsize>(stride));
+            }
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black).
+     *
+     * Post-Conditions:
+     *      Returns a binary portable pixmap (P6), 3 bytes per pixel.
+     */
+    vector<uint8_t> BitmapWriter::toPpm(const SquareMatrix& matrix,
+                                        int scale,
+                                        int border_width,
+                                        uint32_t light_color,
+                                        uint32_t dark_color) {
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const string header{"P6\n" + to_string(side) + " " + to_string(side) + "\n255\n"};
+        const uint8_t light[3]{static_cast<uint8_t>(light_color >> 16),
+                               static_cast<uint8_t>(light_color >> 8),
+                               static_cast<uint8_t>(light_color)};
+        const uint8_t dark[3]{static_cast<uint8_t>(dark_color >> 16),
+                              static_cast<uint8_t>(dark_color >> 8),
+                              static_cast<uint8_t>(dark_color)};
+
+        vector<uint8_t> result{header.begin(), header.end()}, border(side * sizeof(light)), line{};
+
+        result.reserve(header.size() + side * border.size());
+
+        for (size_t x{0}; x < side; x++) {
+            memcpy(border.data() + x * sizeof(light), light, sizeof(light));
+        }
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            if (not quiet) {
+                line = border;
+                paintRow(matrix, i - border_width, scale, border_width, line.data(), dark, sizeof(dark));
+            }
+
+            for (int k{0}; k < scale; k++) {
+                result.insert(result.end(), (quiet ? border : line).begin(), (quiet ? border : line).end());
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      module row index in [0, size[,
+     *      scale in pixels,
+     *      border width in modules,
+     *      scanline of (size + 2 * border width) * scale pixels, prefilled with the light color,
+     *      dark pixel,
+     *      number of bytes per pixel.
+     *
+     * Post-Conditions:
+     *      Paints the dark modules of the row onto the scanline,
+     *      each run of dark modules is filled by doubling copies of its first pixel.
+     */
+    void BitmapWriter::paintRow(const SquareMatrix& matrix, size_t row, int scale, int border_width,
+                                uint8_t* line, const uint8_t* dark, size_t pixel_size) {
+        const size_t S{matrix.size()};
+        const size_t width{(S + 2 * border_width) * scale};
+        const vector<bool>& modules{matrix[row]};
+
+        for (size_t j{0}; j < S; j++) {
+            if (not modules[j]) {
+                continue;
+            }
+
+            /* Find the end of the run of dark modules */
+            size_t end{j + 1};
+
+            while (end < S and modules[end]) {
+                end++;
+            }
+
+            const size_t first{(j + border_width) * scale};
+            const size_t count{min((end - j) * scale, width - min(first, width))};
+            uint8_t* run{line + first * pixel_size};
+
+            if (count != 0) {
+                memcpy(run, dark, pixel_size);
+
+                for (size_t filled{1}; filled < count; filled *= 2) {
+                    memcpy(run + filled * pixel_size, run, min(filled, count - filled) * pixel_size);
+                }
+            }
+
+            j = end;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      top left pixel of the destination region,
+     *      bytes between the starts of consecutive rows of the destination,
+     *      width & height of the region in pixels,
+     *      bytes per pixel (1 for gray, 3 for BGR, or 4 for BGRA),
+     *      scale in pixels,
+     *      border width in modules,
+     *      RGB light color,
+     *      RGB dark color.
+     *
+     * Post-Conditions:
+     *      Draws the QR code at the top left of the region, in the pixel format of the region.
+     *      Pixels of the region outside of the QR code are left untouched.
+     *      Throws an invalid argument exception if the pixel format is unsupported
+     *      or the QR code does not fit in the region.
+     *
+     * Only the first pixel row of each module row is painted, the others are copies.
+     */
+    void BitmapWriter::renderInto(const SquareMatrix& matrix,
+                                  uint8_t* pixels,
+                                  size_t stride,
+                                  int width,
+                                  int height,
+                                  size_t channels,
+                                  int scale,
+                                  int border_width,
+                                  uint32_t light_color,
+                                  uint32_t dark_color) {
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+
+        if (channels != 1 and channels != 3 and channels != 4) {
+            throw invalid_argument("Only 1, 3, or 4 channel 8 bit images are supported");
+        }
+
+        if (width < 0 or height < 0 or static_cast<size_t>(width) < side
+            or static_cast<size_t>(height) < side or stride < side * channels) {
+            throw invalid_argument("QR code of " + to_string(side) + " pixels does not fit in the region");
+        }
+
+        uint8_t light[4], dark[4];
+
+        getPixel(light_color, channels, light);
+        getPixel(dark_color, channels, dark);
+
+        /* Light scanline, filled by doubling copies of its first pixel */
+        vector<uint8_t> border(side * channels);
+
+        memcpy(border.data(), light, channels);
+
+        for (size_t filled{1}; filled < side; filled *= 2) {
+            memcpy(border.data() + filled * channels, border.data(), min(filled, side - filled) * channels);
+        }
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            uint8_t* line{pixels + i * scale * stride};
+            const bool quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            memcpy(line, border.data(), border.size());
+
+            if (not quiet) {
+                paintRow(matrix, i - border_width, scale, border_width, line, dark, channels);
+            }
+
+            for (int k{1}; k < scale; k++) {
+                memcpy(line + k * stride, line, border.size());
+            }
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Top left pixel of an 8 bit gray or BGR image,
+     *      bytes between the starts of consecutive rows,
+     *      width & height in pixels,
+     *      bytes per pixel (1 or 3),
+     *      optional zlib compression level in [0, 9] (-1 for the default),
+     *      optional zlib compression strategy.
+     *
+     * Post-Conditions:
+     *      Returns an 8 bit grayscale or truecolor PNG of the image,
+     *      every row uses filter type 0 & BGR pixels are swapped to RGB.
+     *      Throws an invalid argument exception for other pixel formats.
+     */
+    vector<uint8_t> BitmapWriter::toPng(const uint8_t* pixels,
+                                        size_t stride,
+                                        int width,
+                                        int height,
+                                        size_t channels,
+                                        int compression,
+                                        PngStrategy strategy) {
+        const static uint8_t SIGNATURE[8]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+        if (channels != 1 and channels != 3) {
+            throw invalid_argument("Only 1 or 3 channel 8 bit images are supported");
+        }
+
+        const size_t row_size{static_cast<size_t>(width) * channels};
+        vector<uint8_t> header{}, raw{};
+
+        raw.reserve((row_size + 1) * height);
+
+        for (int y{0}; y < height; y++) {
+            const uint8_t* row{pixels + y * stride};
+
+            raw.push_back(0);
+
+            if (channels == 1) {
+                raw.insert(raw.end(), row, row + row_size);
+                continue;
+            }
+
+            for (size_t x{0}; x < row_size; x += 3) {
+                raw.insert(raw.end(), {row[x + 2], row[x + 1], row[x]});
+            }
+        }
+
+        appendBigEndian(header, static_cast<uint32_t>(width), 4);
+        appendBigEndian(header, static_cast<uint32_t>(height), 4);
+
+        /* Bit depth 8, gray or truecolor, deflate, adaptive filtering, no interlace */
+        header.insert(header.end(), {8, static_cast<uint8_t>(channels == 1 ? 0 : 2), 0, 0, 0});
+
+        vector<uint8_t> result{SIGNATURE, SIGNATURE + sizeof(SIGNATURE)};
+
+        appendChunk(result, "IHDR", header);
+        appendChunk(result, "IDAT", getZlibStream(raw, compression, strategy));
+        appendChunk(result, "IEND", {});
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Top left pixel of an 8 bit gray or BGR image,
+     *      bytes between the starts of consecutive rows,
+     *      width & height in pixels,
+     *      bytes per pixel (1 or 3).
+     *
+     * Post-Conditions:
+     *      Returns a binary portable graymap (P5) or pixmap (P6) of the image.
+     *      Throws an invalid argument exception for other pixel formats.
+     */
+    vector<uint8_t> BitmapWriter::toPpm(const uint8_t* pixels, size_t stride, int width, int height,
+                                        size_t channels) {
+        if (channels != 1 and channels != 3) {
+            throw invalid_argument("Only 1 or 3 channel 8 bit images are supported");
+        }
+
+        const string header{(channels == 1 ? "P5\n" : "P6\n") + to_string(width) + " "
+                            + to_string(height) + "\n255\n"};
+        const size_t row_size{static_cast<size_t>(width) * channels};
+
+        vector<uint8_t> result{header.begin(), header.end()};
+
+        result.reserve(header.size() + row_size * height);
+
+        for (int y{0}; y < height; y++) {
+            const uint8_t* row{pixels + y * stride};
+
+            if (channels == 1) {
+                result.insert(result.end(), row, row + row_size);
+                continue;
+            }
+
+            for (size_t x{0}; x < row_size; x += 3) {
+                result.insert(result.end(), {row[x + 2], row[x + 1], row[x]});
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in pixels (default 10px),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional RGB light color (default white),
+     *      optional RGB dark color (default black).
+     *
+     * Post-Conditions:
+     *      Returns a 1 bit BMP with a two color palette.
+     *      Rows are stored bottom up, each padded to 4 bytes.
+     */
+    vector<uint8_t> BitmapWriter::toBmp(const SquareMatrix& matrix,
+                                        int scale,
+                                        int border_width,
+                                        uint32_t light_color,
+                                        uint32_t dark_color) {
+        /* File header, BITMAPINFOHEADER, & two palette entries */
+        const static uint32_t OFFSET{14 + 40 + 8};
+
+        const size_t side{(matrix.size() + 2 * border_width) * scale};
+        const vector<vector<uint8_t>> lines{getScanlines(matrix, scale, border_width, true)};
+        const size_t stride{(lines.back().size() + 3) / 4 * 4};
+
+        vector<uint8_t> result{'B', 'M'};
+
+        result.reserve(OFFSET + side * stride);
+
+        appendLittleEndian(result, static_cast<uint32_t>(OFFSET + side * stride), 4);
+        appendLittleEndian(result, 0, 4);
+        appendLittleEndian(result, OFFSET, 4);
+
+        appendLittleEndian(result, 40, 4);
+        appendLittleEndian(result, static_cast<uint32_t>(side), 4);
+        appendLittleEndian(result, static_cast<uint32_t>(side), 4);
+        appendLittleEndian(result, 1, 2);
+        appendLittleEndian(result, 1, 2);
+        appendLittleEndian(result, 0, 4);
+        appendLittleEndian(result, static_cast<uint32_t>(side * stride), 4);
+
+        /* 2835 pixels per meter (72 DPI) */
+        appendLittleEndian(result, 2835, 4);
+        appendLittleEndian(result, 2835, 4);
+        appendLittleEndian(result, 2, 4);
+        appendLittleEndian(result, 0, 4);
+
+        /* Palette entries are stored as BGR0 */
+        appendLittleEndian(result, light_color & 0xFFFFFF, 4);
+        appendLittleEndian(result, dark_color & 0xFFFFFF, 4);
+
+        for (size_t y{side}; y-- > 0;) {
+            const vector<uint8_t>& line{getScanline(lines, y, scale, border_width)};
+
+            result.insert(result.end(), line.begin(), line.end());
+            result.insert(result.end(), stride - line.size(), 0);
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      scale in pixels,
+     *      border width in modules,
+     *      bit value of the dark pixels.
+     *
+     * Post-Conditions:
+     *      Returns the packed scanline (most significant bit first) of every module row,
+     *      followed by the scanline of the quiet zone.
+     */
+    vector<vector<uint8_t>> BitmapWriter::getScanlines(const SquareMatrix& matrix,
+                                                       int scale,
+                                                       int border_width,
+                                                       bool dark_bit) {
+        const size_t S{matrix.size()};
+        const size_t bytes{((S + 2 * border_width) * scale + 7) / 8};
+
+        vector<vector<uint8_t>> result(S + 1, vector<uint8_t>(bytes, 0));
+
+        for (size_t i{0}; i <= S; i++) {
+            packRow(matrix, i, scale, border_width, dark_bit, result[i].data());
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Scanlines returned by getScanlines,
+     *      pixel row of the image,
+     *      scale in pixels,
+     *      border width in modules.
+     *
+     * Post-Conditions:
+     *      Returns the scanline of the given pixel row.
+     */
+    const vector<uint8_t>& BitmapWriter::getScanline(const vector<vector<uint8_t>>& lines,
+                                                     size_t y, int scale, int border_width) {
+        const size_t module{y / scale};
+        const size_t S{lines.size() - 1};
+
+        if (module < static_cast<size_t>(border_width) or module >= S + border_width) {
+            return lines.back();
+        }
+
+        return lines[module - border_width];
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      module row index in [0, size] (size for the quiet zone),
+     *      scale in pixels,
+     *      border width in modules,
+     *      bit value of the dark pixels,
+     *      output packed scanline of (side + 7) / 8 bytes.
+     *
+     * Post-Conditions:
+     *      Packs the module row into the scanline (most significant bit first).
+     *      Pixels past the image width are padding, always zero.
+     */
+    void BitmapWriter::packRow(const SquareMatrix& matrix,
+                               size_t i,
+                               int scale,
+                               int border_width,
+                               bool dark_bit,
+                               uint8_t* line) {
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const size_t bytes{(side + 7) / 8};
+
+        memset(line, 0, bytes);
+
+        for (size_t j{0}; i < S and j < S; j++) {
+            if (not matrix[i][j]) {
+                continue;
+            }
+
+            const size_t start{j};
+
+            while (j < S and matrix[i][j]) {
+                j++;
+            }
+
+            setBits(line, (start + border_width) * scale, (j - start) * scale);
+        }
+
+        if (not dark_bit) {
+            for (size_t k{0}; k < bytes; k++) {
+                line[k] = static_cast<uint8_t>(~line[k]);
+            }
+
+            if (side % 8 != 0) {
+                line[bytes - 1] &= static_cast<uint8_t>(0xFF << (8 - side % 8));
+            }
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Packed scanline,
+     *      first pixel,
+     *      number of pixels.
+     *
+     * Post-Conditions:
+     *      Sets the bits of the given pixels, whole bytes at once.
+     */
+    void BitmapWriter::setBits(uint8_t* line, size_t first, size_t count) {
+        size_t pixel{first};
+        const size_t end{first + count};
+
+        while (pixel < end and pixel % 8 != 0) {
+            line[pixel / 8] |= static_cast<uint8_t>(0x80 >> (pixel % 8));
+            pixel++;
+        }
+
+        if (end - pixel >= 8) {
+            memset(line + pixel / 8, 0xFF, (end - pixel) / 8);
+            pixel += (end - pixel) / 8 * 8;
+        }
+
+        while (pixel < end) {
+            line[pixel / 8] |= static_cast<uint8_t>(0x80 >> (pixel % 8));
+            pixel++;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output bytes,
+     *      value,
+     *      number of bytes.
+     *
+     * Post-Conditions:
+     *      Appends the value in big endian order (PNG).
+     */
+    void BitmapWriter::appendBigEndian(vector<uint8_t>& output, uint32_t value, int count) {
+        for (int i{count - 1}; i >= 0; i--) {
+            output.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output bytes,
+     *      value,
+     *      number of bytes.
+     *
+     * Post-Conditions:
+     *      Appends the value in little endian order (BMP).
+     */
+    void BitmapWriter::appendLittleEndian(vector<uint8_t>& output, uint32_t value, int count) {
+        for (int i{0}; i < count; i++) {
+            output.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output bytes,
+     *      four letter chunk type,
+     *      chunk data.
+     *
+     * Post-Conditions:
+     *      Appends the PNG chunk with its length & CRC (over the type & data).
+     */
+    void BitmapWriter::appendChunk(vector<uint8_t>& output, const string& type,
+                                   const vector<uint8_t>& data) {
+        appendBigEndian(output, static_cast<uint32_t>(data.size()), 4);
+
+        const size_t start{output.size()};
+
+        output.insert(output.end(), type.begin(), type.end());
+        output.insert(output.end(), data.begin(), data.end());
+
+        appendBigEndian(output, getCrc(output.data() + start, output.size() - start), 4);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Raw bytes,
+     *      zlib compression level in [0, 9] (-1 for the default),
+     *      zlib compression strategy.
+     *
+     * Post-Conditions:
+     *      Returns the zlib stream of the bytes (RFC 1950).
+     *      Without zlib, the bytes are split into stored deflate blocks (RFC 1951 3.2.4).
+     *      Throws a domain error if the compression fails.
+     */
+    vector<uint8_t> BitmapWriter::getZlibStream(const vector<uint8_t>& raw,
+                                                int compression,
+                                                PngStrategy strategy) {
+#ifdef QRIO_WITH_ZLIB
+        z_stream stream{};
+
+        if (deflateInit2(&stream, compression, Z_DEFLATED, MAX_WBITS, 8,
+                         static_cast<int>(strategy)) != Z_OK) {
+            throw domain_error("Invalid PNG compression level or strategy");
+        }
+
+        vector<uint8_t> result(deflateBound(&stream, static_cast<uLong>(raw.size())));
+
+        stream.next_in = const_cast<Bytef*>(raw.data());
+        stream.avail_in = static_cast<uInt>(raw.size());
+        stream.next_out = result.data();
+        stream.avail_out = static_cast<uInt>(result.size());
+
+        const int status{deflate(&stream, Z_FINISH)};
+
+        result.resize(stream.total_out);
+        deflateEnd(&stream);
+
+        if (status != Z_STREAM_END) {
+            throw domain_error("PNG compression failed");
+        }
+
+        return result;
+#else
+        /* Maximum length of a stored block */
+        const static size_t MAX_STORED{65'535};
+
+        static_cast<void>(compression);
+        static_cast<void>(strategy);
+
+        /* Deflate with a 32K window, no preset dictionary, fastest level */
+        vector<uint8_t> result{0x78, 0x01};
+        uint32_t a{1}, b{0};
+
+        size_t offset{0};
+
+        do {
+            const size_t length{min(raw.size() - offset, MAX_STORED)};
+            const bool last{offset + length == raw.size()};
+
+            result.push_back(last ? 1 : 0);
+            appendLittleEndian(result, static_cast<uint32_t>(length), 2);
+            appendLittleEndian(result, static_cast<uint32_t>(~length & 0xFFFF), 2);
+            result.insert(result.end(), raw.begin() + static_cast<long>(offset),
+                          raw.begin() + static_cast<long>(offset + length));
+            offset += length;
+        } while (offset < raw.size());
+
+        /* Adler-32 checksum of the raw bytes */
+        for (uint8_t byte: raw) {
+            a = (a + byte) % 65'521;
+            b = (b + a) % 65'521;
+        }
+
+        appendBigEndian(result, b << 16 | a, 4);
+
+        return result;
+#endif
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Bytes,
+     *      number of bytes.
+     *
+     * Post-Conditions:
+     *      Returns the CRC-32 of the bytes (ISO 3309, as used by PNG).
+     */
+    uint32_t BitmapWriter::getCrc(const uint8_t* data, size_t size) {
+        const static array<uint32_t, 256> TABLE{[] {
+            array<uint32_t, 256> table{};
+
+            for (uint32_t i{0}; i < table.size(); i++) {
+                uint32_t value{i};
+
+                for (int k{0}; k < 8; k++) {
+                    value = value & 1 ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+                }
+
+                table[i] = value;
+            }
+
+            return table;
+        }()};
+
+        uint32_t result{0xFFFFFFFF};
+
+        for (size_t i{0}; i < size; i++) {
+            result = TABLE[(result ^ data[i]) & 0xFF] ^ (result >> 8);
+        }
+
+        return ~result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      RGB color,
+     *      bytes per pixel (1, 3, or 4),
+     *      output pixel.
+     *
+     * Post-Conditions:
+     *      Writes the color as a gray (ITU-R BT.601 luma), BGR, or opaque BGRA pixel.
+     */
+    void BitmapWriter::getPixel(uint32_t color, size_t channels, uint8_t* pixel) {
+        const uint32_t red{(color >> 16) & 0xFF}, green{(color >> 8) & 0xFF}, blue{color & 0xFF};
+
+        if (channels == 1) {
+            /* Same weights & rounding as cv::cvtColor, in 14 bit fixed point */
+            pixel[0] = static_cast<uint8_t>((red * 4899 + green * 9617 + blue * 1868 + (1 << 13)) >> 14);
+            return;
+        }
+
+        pixel[0] = static_cast<uint8_t>(blue);
+        pixel[1] = static_cast<uint8_t>(green);
+        pixel[2] = static_cast<uint8_t>(red);
+
+        if (channels == 4) {
+            pixel[3] = 0xFF;
+        }
+    }
+}
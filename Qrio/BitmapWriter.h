@@ -0,0 +1,375 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_BITMAPWRITER_H
+#define QR_IO_BITMAPWRITER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "PngStrategy.h"
+#include "SquareMatrix.h"
+
+
+namespace Qrio {
+    /*
+     * BitmapWriter: 1.0
+     *
+     * Writes a QR matrix as a 1 bit per pixel image (PBM, PNG, or BMP),
+     * straight from packed scanlines: each module row is packed once
+     * & reused for all the pixel rows it covers.
+     * Also writes 3 channel PPM images, 8 bit PNG & PPM images of pixel buffers,
+     * & paints N channel images.
+     * Colors are given as 0xRRGGBB & stored in a two entry palette
+     * when the format has one.
+     */
+    class BitmapWriter final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8).
+         *
+         * Post-Conditions:
+         *      Returns a binary portable bitmap (P4), dark modules are black.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPbm(const SquareMatrix&,
+                                                        int scale = 10,
+                                                        int border_width = 4);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black),
+         *      optional zlib compression level in [0, 9] (-1 for the default),
+         *      optional zlib compression strategy.
+         *
+         * Post-Conditions:
+         *      Returns a 1 bit PNG, grayscale for black on white, otherwise with a palette.
+         *      The image data is stored uncompressed when built without zlib.
+         *      Throws a domain error if the compression fails.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPng(const SquareMatrix&,
+                                                        int scale = 10,
+                                                        int border_width = 4,
+                                                        uint32_t light_color = 0xFFFFFF,
+                                                        uint32_t dark_color = 0x000000,
+                                                        int compression = -1,
+                                                        PngStrategy strategy = PngStrategy::DEFAULT);
+
+        /*
+         * Pre-Conditions:
+         *      Output stream (opened in binary mode for files),
+         *      row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black),
+         *      optional zlib compression level in [0, 9] (-1 for the default),
+         *      optional zlib compression strategy.
+         *
+         * Post-Conditions:
+         *      Streams the 1 bit PNG of toPng to the output, one module row at a time.
+         *      Memory use is bounded by a few scanlines, whatever the scale.
+         *      Throws a domain error if the compression fails.
+         */
+        static void writePng(std::ostream&,
+                             const SquareMatrix&,
+                             int scale = 10,
+                             int border_width = 4,
+                             uint32_t light_color = 0xFFFFFF,
+                             uint32_t dark_color = 0x000000,
+                             int compression = -1,
+                             PngStrategy strategy = PngStrategy::DEFAULT);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns an uncompressed 1 bit TIFF, bilevel for black on white,
+         *      otherwise with a two color palette.
+         *      Throws a length error if the image exceeds 4 GiB.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toTiff(const SquareMatrix&,
+                                                         int scale = 10,
+                                                         int border_width = 4,
+                                                         uint32_t light_color = 0xFFFFFF,
+                                                         uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Output stream (opened in binary mode for files),
+         *      row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Streams the TIFF of toTiff to the output, one module row at a time.
+         *      Throws a length error if the image exceeds 4 GiB.
+         */
+        static void writeTiff(std::ostream&,
+                              const SquareMatrix&,
+                              int scale = 10,
+                              int border_width = 4,
+                              uint32_t light_color = 0xFFFFFF,
+                              uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns a 1 bit BMP with a two color palette.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toBmp(const SquareMatrix&,
+                                                        int scale = 10,
+                                                        int border_width = 4,
+                                                        uint32_t light_color = 0xFFFFFF,
+                                                        uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in pixels (default 10px),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns a binary portable pixmap (P6), 3 bytes per pixel.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPpm(const SquareMatrix&,
+                                                        int scale = 10,
+                                                        int border_width = 4,
+                                                        uint32_t light_color = 0xFFFFFF,
+                                                        uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      module row index in [0, size[,
+         *      scale in pixels,
+         *      border width in modules,
+         *      scanline of (size + 2 * border width) * scale pixels, prefilled with the light color,
+         *      dark pixel,
+         *      number of bytes per pixel.
+         *
+         * Post-Conditions:
+         *      Paints the dark modules of the row onto the scanline.
+         */
+        static void paintRow(const SquareMatrix&, size_t, int, int, uint8_t*, const uint8_t*, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      module row index in [0, size] (size for the quiet zone),
+         *      scale in pixels,
+         *      border width in modules,
+         *      bit value of the dark pixels,
+         *      output packed scanline of (side + 7) / 8 bytes.
+         *
+         * Post-Conditions:
+         *      Packs the module row into the scanline (most significant bit first).
+         */
+        static void packRow(const SquareMatrix&, size_t, int, int, bool, uint8_t*);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      top left pixel of the destination region,
+         *      bytes between the starts of consecutive rows of the destination,
+         *      width & height of the region in pixels,
+         *      bytes per pixel (1 for gray, 3 for BGR, or 4 for BGRA),
+         *      scale in pixels,
+         *      border width in modules,
+         *      RGB light color,
+         *      RGB dark color.
+         *
+         * Post-Conditions:
+         *      Draws the QR code at the top left of the region, in the pixel format of the region.
+         *      Pixels of the region outside of the QR code are left untouched.
+         *      Throws an invalid argument exception if the pixel format is unsupported
+         *      or the QR code does not fit in the region.
+         */
+        static void renderInto(const SquareMatrix&, uint8_t*, size_t, int, int, size_t,
+                               int, int, uint32_t, uint32_t);
+
+        /*
+         * Pre-Conditions:
+         *      Top left pixel of an 8 bit gray or BGR image,
+         *      bytes between the starts of consecutive rows,
+         *      width & height in pixels,
+         *      bytes per pixel (1 or 3),
+         *      optional zlib compression level in [0, 9] (-1 for the default),
+         *      optional zlib compression strategy.
+         *
+         * Post-Conditions:
+         *      Returns an 8 bit grayscale or truecolor PNG of the image.
+         *      Throws an invalid argument exception for other pixel formats.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPng(const uint8_t*, size_t, int, int, size_t,
+                                                        int compression = -1,
+                                                        PngStrategy strategy = PngStrategy::DEFAULT);
+
+        /*
+         * Pre-Conditions:
+         *      Top left pixel of an 8 bit gray or BGR image,
+         *      bytes between the starts of consecutive rows,
+         *      width & height in pixels,
+         *      bytes per pixel (1 or 3).
+         *
+         * Post-Conditions:
+         *      Returns a binary portable graymap (P5) or pixmap (P6) of the image.
+         *      Throws an invalid argument exception for other pixel formats.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPpm(const uint8_t*, size_t, int, int, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Bytes,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Returns the CRC-32 of the bytes (ISO 3309, as used by PNG).
+         */
+        [[nodiscard]] static uint32_t getCrc(const uint8_t*, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      RGB color,
+         *      bytes per pixel (1, 3, or 4),
+         *      output pixel.
+         *
+         * Post-Conditions:
+         *      Writes the color as a gray (ITU-R BT.601 luma), BGR, or opaque BGRA pixel.
+         */
+        static void getPixel(uint32_t, size_t, uint8_t*);
+    private:
+        /* Zlib stream split into PNG IDAT chunks as it is produced */
+        class IdatStream;
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      scale in pixels,
+         *      border width in modules,
+         *      bit value of the dark pixels.
+         *
+         * Post-Conditions:
+         *      Returns the packed scanline (most significant bit first) of every module row,
+         *      followed by the scanline of the quiet zone.
+         */
+        [[nodiscard]] static std::vector<std::vector<uint8_t>> getScanlines(const SquareMatrix&,
+                                                                            int, int, bool);
+
+        /*
+         * Pre-Conditions:
+         *      Scanlines returned by getScanlines,
+         *      pixel row of the image,
+         *      scale in pixels,
+         *      border width in modules.
+         *
+         * Post-Conditions:
+         *      Returns the scanline of the given pixel row.
+         */
+        [[nodiscard]] static const std::vector<uint8_t>& getScanline(
+                const std::vector<std::vector<uint8_t>>&, size_t, int, int);
+
+        /*
+         * Pre-Conditions:
+         *      Packed scanline,
+         *      first pixel,
+         *      number of pixels.
+         *
+         * Post-Conditions:
+         *      Sets the bits of the given pixels.
+         */
+        static void setBits(uint8_t*, size_t, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Output bytes,
+         *      value,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Appends the value in big endian order (PNG).
+         */
+        static void appendBigEndian(std::vector<uint8_t>&, uint32_t, int);
+
+        /*
+         * Pre-Conditions:
+         *      Output bytes,
+         *      value,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Appends the value in little endian order (BMP).
+         */
+        static void appendLittleEndian(std::vector<uint8_t>&, uint32_t, int);
+
+        /*
+         * Pre-Conditions:
+         *      Output bytes,
+         *      four letter chunk type,
+         *      chunk data.
+         *
+         * Post-Conditions:
+         *      Appends the PNG chunk with its length & CRC.
+         */
+        static void appendChunk(std::vector<uint8_t>&, const std::string&, const std::vector<uint8_t>&);
+
+        /*
+         * Pre-Conditions:
+         *      Raw bytes,
+         *      zlib compression level in [0, 9] (-1 for the default),
+         *      zlib compression strategy.
+         *
+         * Post-Conditions:
+         *      Returns the zlib stream of the bytes,
+         *      stored uncompressed when built without zlib.
+         */
+        [[nodiscard]] static std::vector<uint8_t> getZlibStream(const std::vector<uint8_t>&,
+                                                                int, PngStrategy);
+    };
+}
+
+
+#endif //QR_IO_BITMAPWRITER_H
@@ -1,8 +1,9 @@
 #include <iostream>
-#include "../Header/CodeFinder.hpp"
-#include "../Header/ImageBinarization.hpp"
+#include "CodeFinder.hpp"
+#include "ImageBinarization.hpp"
 #include <opencv2/highgui/highgui.hpp>
-#include "../Header/Filesystem.hpp"
+#include "Filesystem.hpp"
+#include "Profiler.h"
 
 using namespace std;
 using namespace cv;
@@ -60,11 +61,39 @@ CodeFinder::CodeFinder(Mat image, bool hasCode)
  * \return The best fitting code that could be detected or a 1x1 image if none could be found.
  */
 Mat CodeFinder::find() {
+#ifdef QRIO_PROFILING
+	Qrio::Profiler::begin();
+	Mat result;
+	{
+		QRIO_PROFILE_STAGE(Qrio::Stage::DETECTION);
+		result = search();
+	}
+	profile = Qrio::Profiler::take();
+	return result;
+#else
+	return search();
+#endif
+}
+
+/**
+ * \brief Time, allocations & heap peak of the last call to find.
+ * Mat buffers come from the OpenCV allocator, only the operator new allocations are counted.
+ * \return The profile of the last search, empty unless built with QRIO_PROFILING.
+ */
+Qrio::StageProfile CodeFinder::getProfile() const {
+	return profile;
+}
+
+/**
+ * \brief Analyzes the associated image for a code, trying every threshold method until one succeeds.
+ * \return The best fitting code that could be detected or a 1x1 image if none could be found.
+ */
+Mat CodeFinder::search() {
 	Mat image = originalImage.clone();
 
 	cout << "Converting image to binary image..." << endl;
 	Mat grayscaleImage;
-	cvtColor(image, grayscaleImage, CV_BGR2GRAY);
+	cvtColor(image, grayscaleImage, COLOR_BGR2GRAY);
 
 	ImageBinarization binarizer;
 	int thresholdMethod = -1;
@@ -209,7 +238,7 @@ void CodeFinder::findAllContours() {
 	image /= 255;
 	allContours.clear();
 	hierarchy.clear();
-	findContours(image, allContours, hierarchy, CV_RETR_TREE, CV_CHAIN_APPROX_NONE);
+	findContours(image, allContours, hierarchy, RETR_TREE, CHAIN_APPROX_NONE);
 }
 
 /**
@@ -977,7 +1006,7 @@ Mat CodeFinder::drawAllContours() {
 cv::Mat CodeFinder::drawAllContoursBinarized()
 {
 	Mat image = binarizedImage.clone();
-	cvtColor(image, image, CV_GRAY2BGR);
+	cvtColor(image, image, COLOR_GRAY2BGR);
 	return drawContours(allContours, &image);
 }
 
@@ -1077,7 +1106,7 @@ vector<Mat> CodeFinder::drawExtractedCodeGrids() {
 		if (!code.extractedImage.data)
 			continue;
 
-		cvtColor(code.extractedImage, image, CV_GRAY2BGR);
+		cvtColor(code.extractedImage, image, COLOR_GRAY2BGR);
 		for (int a = 0; a < 4; a++) {
 			for (int b = 0; b < 4; b++) {
 				circle(image, code.transformedCorners.at<Point2f>(a, b), 3, Scalar(0, 0, 255), 2);
@@ -1290,7 +1319,7 @@ void CodeFinder::saveDrawCustomTo(const string& folder, const string&imageFilePa
 
 
 	Mat grayImage;
-	cvtColor(originalImage, grayImage, CV_BGR2GRAY);
+	cvtColor(originalImage, grayImage, COLOR_BGR2GRAY);
 	debugFileName = fs.toFileName(imageFilePath) + "_0___GRAY___" + fs.toExtension(imageFilePath, true);
 	fs.saveImage(fs.toPath(folder, debugFileName), grayImage);
 
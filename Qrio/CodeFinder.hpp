@@ -3,6 +3,7 @@
 
 #include <opencv2/core/core.hpp>
 #include "FinderPatternModel.hpp"
+#include "StageProfile.h"
 
 
 /**
@@ -15,6 +16,8 @@ public:
 
     cv::Mat find();
 
+	Qrio::StageProfile getProfile() const;
+
 	static cv::Mat drawNotFound();
 	
 	cv::Mat drawBinaryImage();
@@ -39,6 +42,8 @@ protected:
     cv::Mat drawLines(std::vector<cv::Vec4f> &lines,
                       cv::Mat *image = nullptr, std::vector<cv::Scalar> *colors = nullptr);
 
+	cv::Mat search();
+
 	void findAllContours();
 	void findPatternContours();
 	void findPatternLines();
@@ -70,6 +75,9 @@ private:
 	/* Not used. */
     bool hasCode;
 
+	/* Time, allocations & heap peak of the last search, empty unless built with QRIO_PROFILING. */
+	Qrio::StageProfile profile;
+
 	/* Original image passed for searching. */
     cv::Mat originalImage;
 
@@ -92,7 +100,7 @@ private:
     std::vector<QRCode> allCodes;
 
     // Constants used for line fitting.
-    static const int fitType = CV_DIST_FAIR;
+    static const int fitType = cv::DIST_FAIR;
     static const int fitReps = 0.01;
     static const int fitAeps = 0.01;
 
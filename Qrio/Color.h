@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_COLOR_H
+#define QR_IO_COLOR_H
+
+#include <cstdint>
+
+
+namespace Qrio {
+    /*
+     * Color: 1.0
+     *
+     * 8 bit per channel color, constructed in BGR order
+     * like the cv::Scalar it replaces (i.e. {255, 0, 0} is blue).
+     * Values outside of [0, 255] are clamped.
+     */
+    class Color final {
+    public:
+        /* Blue channel */
+        uint8_t blue{0};
+
+        /* Green channel */
+        uint8_t green{0};
+
+        /* Red channel */
+        uint8_t red{0};
+
+        /*
+         * Pre-Conditions:
+         *      Optional blue, green, & red channels.
+         *
+         * Post-Conditions:
+         *      Stores the clamped channels.
+         */
+        constexpr Color(int blue = 0, int green = 0, int red = 0):
+                        blue{clamp(blue)}, green{clamp(green)}, red{clamp(red)} {}
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the color as 0xRRGGBB.
+         */
+        [[nodiscard]] constexpr uint32_t toRgb() const {
+            return static_cast<uint32_t>(red) << 16 | static_cast<uint32_t>(green) << 8 | blue;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Color&) const = default;
+    private:
+        /*
+         * Pre-Conditions:
+         *      Channel value.
+         *
+         * Post-Conditions:
+         *      Returns the value clamped to [0, 255].
+         */
+        [[nodiscard]] constexpr static uint8_t clamp(int value) {
+            return static_cast<uint8_t>(value < 0 ? 0 : 255 < value ? 255 : value);
+        }
+    };
+}
+
+
+#endif //QR_IO_COLOR_H
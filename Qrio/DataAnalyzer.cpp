@@ -25,16 +25,19 @@
 #include <unordered_map>
 #include <utility>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "DataAnalyzer.h"
 #include "Ecl.h"
+#include "Profiler.h"
+#include "ShiftJis.h"
 
 
 namespace Qrio {
-    using std::domain_error, std::all_of, std::min, std::move,
+    using std::domain_error, std::all_of, std::any_of, std::min, std::move,
             std::unordered_map, std::string, std::vector, std::wstring,
-            std::range_error;
+            std::range_error, std::invalid_argument, std::stoi;
 
     /*
      * Pre-Conditions:
@@ -51,10 +54,19 @@ namespace Qrio {
      */
     DataAnalyzer::DataAnalyzer(wstring data_cpy, int version, Ecl ecl, Designator override_mode,
                                unordered_map<size_t, int> eci,
-                               int fnc1, int struct_id, int struct_count):
+                               int fnc1, int struct_id, int struct_count,
+                               int struct_parity, bool micro):
     fnc1_value{fnc1}, struct_id{struct_id}, struct_count{struct_count},
+    struct_parity{struct_parity},
     eci{move(eci)}, version{version}, data{move(data_cpy)},
-    ecl{ecl} {
+    ecl{ecl}, micro{micro} {
+        QRIO_PROFILE_STAGE(Stage::ANALYSIS);
+
+        if (micro and (not this->eci.empty() or fnc1 != 0
+                       or struct_id != -1 or struct_count != -1)) {
+            throw invalid_argument("Micro QR codes do not support ECI, FNC1, or structured append");
+        }
+
         checkVersion();
         checkOverrideMode(override_mode);
 
@@ -167,6 +179,124 @@ namespace Qrio {
         }
     }
 
+    /*
+     * Pre-Conditions:
+     *      List of segments (mode, text) with optional ECI entries,
+     *      Version to be used.
+     *
+     * Post-Conditions:
+     *      Segments contains the given segments as is,
+     *      data contains the concatenation of the segment texts.
+     *
+     * No analysis is performed, each segment is validated against
+     * its mode in a single pass.
+     * Throws a range error if a text does not fit its mode,
+     * and an invalid argument exception for invalid modes, ECI entries,
+     * or a list without data segments.
+     */
+    DataAnalyzer::DataAnalyzer(const SegmentList& segments, int version, Ecl ecl,
+                               int fnc1, int struct_id, int struct_count,
+                               int struct_parity):
+    fnc1_value{fnc1}, struct_id{struct_id}, struct_count{struct_count},
+    struct_parity{struct_parity},
+    version{version}, ecl{ecl}, micro{false} {
+        QRIO_PROFILE_STAGE(Stage::ANALYSIS);
+
+        checkVersion();
+
+        /* Stores the bounds of each segment, the data is filled first */
+        vector<size_t> bounds{};
+        vector<Designator> modes{};
+        bool pending_eci{false};
+
+        for (const auto& [mode, text]: segments) {
+            if (mode == Designator::ECI) {
+                if (pending_eci) {
+                    throw invalid_argument("Consecutive ECI entries without data");
+                }
+
+                eci[data.size()] = parseEci(text);
+                pending_eci = true;
+                continue;
+            }
+
+            checkSegment(mode, text);
+
+            bounds.push_back(data.size());
+            modes.push_back(mode);
+            data += text;
+            pending_eci = false;
+        }
+
+        if (pending_eci) {
+            throw invalid_argument("ECI entry must precede a data segment");
+        }
+
+        if (modes.empty()) {
+            throw invalid_argument("No data segment");
+        }
+
+        bounds.push_back(data.size());
+
+        for (size_t i{0}; i < modes.size(); i++) {
+            push_back(DataSegment{data, bounds[i], bounds[i + 1], modes[i]});
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Mode of the segment,
+     *      text of the segment.
+     *
+     * Post-Conditions:
+     *      Throws a range error if the given text cannot be
+     *      encoded in the given mode.
+     */
+    void DataAnalyzer::checkSegment(Designator mode, const wstring& text) {
+        if (text.empty()) {
+            throw range_error("Empty segment");
+        }
+
+        bool valid;
+
+        switch (mode) {
+            case Designator::NUMERIC:
+                valid = isNumeric(text);
+                break;
+            case Designator::ALPHANUMERIC:
+                valid = isCompatibleAlphanumeric(text);
+                break;
+            case Designator::BYTE:
+                valid = isCompatibleByte(text);
+                break;
+            case Designator::KANJI:
+                valid = isKanji(text);
+                break;
+            default:
+                throw invalid_argument("Invalid segment mode, must be numeric, alphanumeric, byte, kanji, or ECI.");
+        }
+
+        if (not valid) {
+            throw range_error("Segment does not fit its mode");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Text of an ECI entry.
+     *
+     * Post-Conditions:
+     *      Returns the ECI assignment value,
+     *      throws an invalid argument exception if it is malformed.
+     */
+    int DataAnalyzer::parseEci(const wstring& text) {
+        if (text.empty() or 6 < text.size() or not isNumeric(text)) {
+            throw invalid_argument("\nInvalid ECI value, expected at most 6 digits\n");
+        }
+
+        return stoi(text);
+    }
+
     /*
      * Pre-Conditions:
      *      A character c.
@@ -205,15 +335,12 @@ namespace Qrio {
      *      Returns true if the given wchar_t is byte.
      *
      * Check Annex J.
+     * Kanji characters are stored as a single value, hence the Shift JIS
+     * lead byte ranges (0x80 to 0x9F & 0xE0 to 0xFF) are bytes as well.
      */
     bool DataAnalyzer::isByte(wchar_t c) {
-        return c == 0x2C
-                or (0x00 <= c and c <= 0x1F)
-                or (0x21 <= c and c <= 0x23)
-                or (0x26 <= c and c <= 0x29)
-                or (0x3B <= c and c <= 0x40)
-                or (0x5B <= c and c <= 0x7F)
-                or (0xA0 <= c and c <= 0xDF);
+        return 0x00 <= c and c <= 0xFF
+                and not isNumeric(c) and not isAlphanumeric(c);
     }
 
     /*
@@ -263,8 +390,8 @@ namespace Qrio {
         if (isAlphanumeric(data[0])) {
             const auto temp{countAlphanumeric(data)};
 
-            if (temp < 6 + range
-                and (isByte(data[temp] or isKanji(data[temp])))) {
+            if (temp < 6 + range and static_cast<size_t>(temp) < data.size()
+                and (isByte(data[temp]) or isKanji(data[temp]))) {
                 return Designator::BYTE;
             }
 
@@ -275,8 +402,8 @@ namespace Qrio {
         if (isNumeric(data[0])) {
             const auto temp{countNumeric(data)};
 
-            if (temp < (range == 2 ? 5 : 4)
-                and (isByte(data[temp] or isKanji(data[temp])))) {
+            if (temp < (range == 2 ? 5 : 4) and static_cast<size_t>(temp) < data.size()
+                and (isByte(data[temp]) or isKanji(data[temp]))) {
                 return Designator::BYTE;
             }
 
@@ -443,10 +570,16 @@ namespace Qrio {
      *      None.
      *
      * Post-Conditions:
-     *      Throws a domain exception if the version is out of bounds.
+     *      Throws a domain exception if the version is out of bounds,
+     *      or if a Micro QR version does not support the ECL.
      */
     void DataAnalyzer::checkVersion() const {
-        if (version < MIN_VERSION or MAX_VERSION < version) {
+        if (micro) {
+            if (version < MIN_VERSION or MAX_MICRO_VERSION < version
+                or MicroSymbolNumber[getEclIndex()][version] == -1) {
+                throw domain_error("Micro QR version out of bounds [1, 4] or ECL unsupported");
+            }
+        } else if (version < MIN_VERSION or MAX_VERSION < version) {
             throw domain_error("Data too long or version out of bounds [1, 40]");
         }
     }
@@ -520,6 +653,69 @@ namespace Qrio {
         return isKanji(c / (16 * 16), c % (16 * 16));
     }
 
+    /*
+     * Pre-Conditions:
+     *      Unicode string (UTF-32, or UTF-16 with surrogate pairs),
+     *      reference to the ECI map of the result.
+     *
+     * Post-Conditions:
+     *      Returns the data string, where the characters encodable in
+     *      Kanji mode are replaced by their Shift JIS code.
+     *      If any other character is beyond Latin-1, the remaining
+     *      characters beyond ASCII are replaced by their UTF-8 bytes
+     *      & the UTF-8 ECI is placed at index 0.
+     *      Throws an invalid argument exception for invalid code points.
+     */
+    wstring DataAnalyzer::fromUnicode(const wstring& text, unordered_map<size_t, int>& eci) {
+        vector<long> code_points{};
+
+        for (size_t i{0}; i < text.size(); i++) {
+            long c{static_cast<long>(text[i])};
+
+            /* Combine UTF-16 surrogate pairs */
+            if (0xD800 <= c and c <= 0xDBFF and i + 1 < text.size()
+                and 0xDC00 <= text[i + 1] and text[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (text[++i] - 0xDC00);
+            } else if (c < 0 or 0x10FFFF < c or (0xD800 <= c and c <= 0xDFFF)) {
+                throw invalid_argument("Invalid Unicode code point");
+            }
+
+            code_points.push_back(c);
+        }
+
+        const bool utf8{any_of(code_points.begin(), code_points.end(), [](auto c) {
+            return 0xFF < c and not ShiftJis::isKanji(c);
+        })};
+
+        wstring result{};
+
+        for (auto c: code_points) {
+            if (0xFF < c and ShiftJis::isKanji(c)) {
+                result += static_cast<wchar_t>(ShiftJis::fromUnicode(c));
+            } else if (c < 0x80 or not utf8) {
+                result += static_cast<wchar_t>(c);
+            } else if (c < 0x800) {
+                result += static_cast<wchar_t>(0xC0 | c >> 6);
+                result += static_cast<wchar_t>(0x80 | (c & 0x3F));
+            } else if (c < 0x10000) {
+                result += static_cast<wchar_t>(0xE0 | c >> 12);
+                result += static_cast<wchar_t>(0x80 | (c >> 6 & 0x3F));
+                result += static_cast<wchar_t>(0x80 | (c & 0x3F));
+            } else {
+                result += static_cast<wchar_t>(0xF0 | c >> 18);
+                result += static_cast<wchar_t>(0x80 | (c >> 12 & 0x3F));
+                result += static_cast<wchar_t>(0x80 | (c >> 6 & 0x3F));
+                result += static_cast<wchar_t>(0x80 | (c & 0x3F));
+            }
+        }
+
+        if (utf8) {
+            eci[0] = UTF8_ECI;
+        }
+
+        return result;
+    }
+
     /*
      * Pre-Conditions:
      *      Data string.
@@ -624,6 +820,10 @@ namespace Qrio {
      *      Returns the EccPerBlock based on the data fields.
      */
     int DataAnalyzer::getEccPerBlock() const {
+        if (micro) {
+            return MicroEccPerBlock[getEclIndex()][getVersion()];
+        }
+
         return EccPerBlock[getEclIndex()][getVersion()];
     }
 
@@ -635,7 +835,7 @@ namespace Qrio {
      *      Returns the number of EccBlocks based on the data fields.
      */
     int DataAnalyzer::getEccBlocksCount() const {
-        return NumberOfEccBlocks[getEclIndex()][getVersion()];
+        return micro ? 1 : NumberOfEccBlocks[getEclIndex()][getVersion()];
     }
 
     /*
@@ -649,6 +849,31 @@ namespace Qrio {
         return static_cast<int>(getEcl());
     }
 
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns true if the symbol is a Micro QR code.
+     */
+    bool DataAnalyzer::isMicro() const {
+        return micro;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Micro QR code.
+     *
+     * Post-Conditions:
+     *      Returns the symbol number of the version & ECL combination,
+     *      used in the format information.
+     *
+     * Based on table 13 of ISO/IEC 18004:2015.
+     */
+    int DataAnalyzer::getSymbolNumber() const {
+        return MicroSymbolNumber[getEclIndex()][getVersion()];
+    }
+
     /*
      * Pre-Conditions:
      *      None.
@@ -659,5 +884,6 @@ namespace Qrio {
      * Default constructor, used temporarily by the QrCode class.
      */
     DataAnalyzer::DataAnalyzer():
-    fnc1_value{-1}, struct_id{-1}, struct_count{-1}, version{-1}, ecl{} {}
+    fnc1_value{-1}, struct_id{-1}, struct_count{-1}, struct_parity{-1},
+    version{-1}, ecl{}, micro{false} {}
 }
@@ -26,6 +26,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "DataSegment.h"
@@ -34,7 +35,14 @@
 
 namespace Qrio {
     /*
-     * DataAnalyzer: 1.6.0
+     * List of explicit (mode, text) segments.
+     * A Designator::ECI entry holds the ECI assignment value as digits,
+     * it applies to the data segment that follows it.
+     */
+    typedef std::vector<std::pair<Designator, std::wstring>> SegmentList;
+
+    /*
+     * DataAnalyzer: 1.9.0
      *
      * Divides the given data string into DataSegments in the most optimal way.
      * The optimization is based on Annex J of ISO/IEC 18004:2015 page 99.
@@ -57,9 +65,21 @@ namespace Qrio {
          */
         const int struct_count;
 
+        /*
+         * Parity of the whole structured append message,
+         * -1 indicates that the parity is derived from this symbol's data.
+         */
+        const int struct_parity;
+
         /* Version boundaries for a QR code */
         const static int MIN_VERSION{1}, MAX_VERSION{40};
 
+        /* Upper version boundary for a Micro QR code (M1 to M4) */
+        const static int MAX_MICRO_VERSION{4};
+
+        /* ECI assignment value of UTF-8 */
+        const static int UTF8_ECI{26};
+
         /*
          * Pre-Conditions:
          *      Data string,
@@ -74,6 +94,10 @@ namespace Qrio {
          * Fills the segments with the optimal DataSegments.
          *
          * When using FNC1, the % (0x1D) must be doubled by the user.
+         *
+         * Micro QR codes (versions M1 to M4) do not support ECI, FNC1,
+         * or structured append, an invalid argument exception is thrown
+         * if any of them is given.
          */
         explicit DataAnalyzer(std::wstring,
                               int,
@@ -82,7 +106,32 @@ namespace Qrio {
                               std::unordered_map<size_t, int> eci = {},
                               int fnc1 = 0,
                               int struct_id = -1,
-                              int struct_count = -1);
+                              int struct_count = -1,
+                              int struct_parity = -1,
+                              bool micro = false);
+
+        /*
+         * Pre-Conditions:
+         *      List of segments (mode, text) with optional ECI entries,
+         *      Version to be used.
+         *
+         * Post-Conditions:
+         *      Segments contains the given segments as is,
+         *      data contains the concatenation of the segment texts.
+         *
+         * No analysis is performed, each segment is validated against
+         * its mode in a single pass.
+         * Throws a range error if a text does not fit its mode,
+         * and an invalid argument exception for invalid modes, ECI entries,
+         * or a list without data segments.
+         */
+        explicit DataAnalyzer(const SegmentList&,
+                              int,
+                              Ecl ecl = Ecl::L,
+                              int fnc1 = 0,
+                              int struct_id = -1,
+                              int struct_count = -1,
+                              int struct_parity = -1);
 
         /*
          * Pre-Conditions:
@@ -122,6 +171,15 @@ namespace Qrio {
          */
         [[nodiscard]] Ecl getEcl() const;
 
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns true if the symbol is a Micro QR code.
+         */
+        [[nodiscard]] bool isMicro() const;
+
         /*
          * Pre-Conditions:
          *      None.
@@ -131,6 +189,18 @@ namespace Qrio {
          */
         [[nodiscard]] int getEclBits() const;
 
+        /*
+         * Pre-Conditions:
+         *      Micro QR code.
+         *
+         * Post-Conditions:
+         *      Returns the symbol number of the version & ECL combination,
+         *      used in the format information.
+         *
+         * Based on table 13 of ISO/IEC 18004:2015.
+         */
+        [[nodiscard]] int getSymbolNumber() const;
+
         /*
          * Pre-Conditions:
          *      None.
@@ -205,6 +275,22 @@ namespace Qrio {
          *      Returns true if the given wchar_t is kanji.
          */
         [[nodiscard]] static bool isKanji(wchar_t);
+
+        /*
+         * Pre-Conditions:
+         *      Unicode string (UTF-32, or UTF-16 with surrogate pairs),
+         *      reference to the ECI map of the result.
+         *
+         * Post-Conditions:
+         *      Returns the data string, where the characters encodable in
+         *      Kanji mode are replaced by their Shift JIS code.
+         *      If any other character is beyond Latin-1, the remaining
+         *      characters beyond ASCII are replaced by their UTF-8 bytes
+         *      & the UTF-8 ECI is placed at index 0.
+         *      Throws an invalid argument exception for invalid code points.
+         */
+        [[nodiscard]] static std::wstring fromUnicode(const std::wstring&,
+                                                      std::unordered_map<size_t, int>&);
     private:
         /* Based on table 9 page 38 */
         const int EccPerBlock[4][41] = {
@@ -258,6 +344,26 @@ namespace Qrio {
                     66, 70, 74, 77, 81},  // High
         };
 
+        /*
+         * Based on table 9 page 38, Micro QR codes consist of a single block.
+         * M1 provides error detection only, it is listed under Low.
+         */
+        const int MicroEccPerBlock[4][5] = {
+                // Version: (note that index 0 is for padding, and is set to an illegal value)
+                {-1,  2,  5,  6,  8},   // Low
+                {-1, -1,  6,  8, 10},   // Medium
+                {-1, -1, -1, -1, 14},   // Quartile
+                {-1, -1, -1, -1, -1},   // High
+        };
+
+        /* Based on table 13, -1 marks an unsupported version & ECL combination */
+        const int MicroSymbolNumber[4][5] = {
+                {-1,  0,  1,  3,  5},   // Low
+                {-1, -1,  2,  4,  6},   // Medium
+                {-1, -1, -1, -1,  7},   // Quartile
+                {-1, -1, -1, -1, -1},   // High
+        };
+
         /*
          * Map of ECIs to be placed in the encoding.
          * Each key is an index, & each value is the ECI value.
@@ -275,6 +381,9 @@ namespace Qrio {
         /* Error correction level */
         Ecl ecl;
 
+        /* True if the symbol is a Micro QR code */
+        bool micro;
+
         /*
          * Pre-Conditions:
          *      A character c.
@@ -392,7 +501,8 @@ namespace Qrio {
          *      Data initialized.
          *
          * Post-Conditions:
-         *      Throws a domain exception if the version is out of bounds.
+         *      Throws a domain exception if the version is out of bounds,
+         *      or if a Micro QR version does not support the ECL.
          */
         void checkVersion() const;
 
@@ -406,6 +516,27 @@ namespace Qrio {
          */
         void checkOverrideMode(Designator override_mode) const;
 
+        /*
+         * Pre-Conditions:
+         *      Mode of the segment,
+         *      text of the segment.
+         *
+         * Post-Conditions:
+         *      Throws a range error if the given text cannot be
+         *      encoded in the given mode.
+         */
+        static void checkSegment(Designator, const std::wstring&);
+
+        /*
+         * Pre-Conditions:
+         *      Text of an ECI entry.
+         *
+         * Post-Conditions:
+         *      Returns the ECI assignment value,
+         *      throws an invalid argument exception if it is malformed.
+         */
+        [[nodiscard]] static int parseEci(const std::wstring&);
+
         /*
          * Pre-Conditions:
          *      Data string.
@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "Encoder.h"
+#include "Profiler.h"
 
 
 namespace Qrio {
@@ -43,32 +44,39 @@ namespace Qrio {
      *      in the DataAnalyzer.
      */
     Encoder::Encoder(const DataAnalyzer& data): codewords(0), analyzer{data} {
+        QRIO_PROFILE_STAGE(Stage::ENCODING);
+
         if (analyzer.struct_count != -1 and analyzer.struct_id != -1) {
             appendSequenceIndicator();
-            appendParityData(analyzer.getData());
+            appendParityData();
         }
 
         for (auto& segment: data) {
             encode(segment);
         }
 
-        const size_t capacity{
-            static_cast<size_t>(8 * getDataCodewordsCount())
-        };
+        if (analyzer.isMicro()) {
+            appendMicroPadding();
+        } else {
+            const size_t capacity{
+                static_cast<size_t>(8 * getDataCodewordsCount())
+            };
 
-        appendBits(static_cast<int>(Designator::TERMINATOR),
-                   min(4, static_cast<int>(capacity - size())));
-        appendBits(static_cast<int>(Designator::TERMINATOR),
-                   (8 - size() % 8) % 8);
+            appendBits(static_cast<int>(Designator::TERMINATOR),
+                       min(4, static_cast<int>(capacity - size())));
+            appendBits(static_cast<int>(Designator::TERMINATOR),
+                       (8 - size() % 8) % 8);
 
-        assert(size() % 8 == 0);
+            assert(size() % 8 == 0);
 
-        // Pad with alternating bytes until data capacity is reached
-        for (int padByte{0xEC}; size() < capacity; padByte ^= 0xEC ^ 0x11)
-            appendBits(padByte, 8);
+            // Pad with alternating bytes until data capacity is reached
+            for (int padByte{0xEC}; size() < capacity; padByte ^= 0xEC ^ 0x11)
+                appendBits(padByte, 8);
+        }
 
-        // Pack bits into bytes in big endian
-        codewords = vector<int>(size() / 8);
+        // Pack bits into bytes in big endian,
+        // the final 4-bit codeword of M1 & M3 occupies the upper bits
+        codewords = vector<int>((size() + 7) / 8);
 
         for (size_t i{0}; i < size(); i++) {
             codewords.at(i >> 3) |= at(i) << (7 - (i & 7));
@@ -262,6 +270,25 @@ namespace Qrio {
         return countBitLengthTable[getBitLengthIndex(mode)][getVersionIndex(version)];
     }
 
+    /*
+     * Pre-Conditions:
+     *      Version of the Micro QR symbol guaranteed in [1, 4].
+     *
+     * Post-Conditions:
+     *      Returns the number of bits in the character count indicator
+     *      for a Micro QR code, based on the given version & mode type.
+     *      Throws a domain error if the mode is unavailable in the version.
+     */
+    int Encoder::getMicroCountBitLength(int version, Designator mode) {
+        const int result{microCountBitLengthTable[getBitLengthIndex(mode)][version - 1]};
+
+        if (result == 0) {
+            throw domain_error("Mode unavailable in the Micro QR version");
+        }
+
+        return result;
+    }
+
     /*
      * Pre-Conditions:
      *      None
@@ -309,9 +336,26 @@ namespace Qrio {
             added_fnc1 = true;
         }
 
+        const auto version{analyzer.getVersion()};
+
+        if (analyzer.isMicro()) {
+            /*
+             * Mode indicators of Micro QR codes are (version - 1) bits long,
+             * their values follow the order of the count bit length table.
+             *
+             * Based on Table 2 of ISO/IEC 18004:2015.
+             */
+            const auto count_bits{getMicroCountBitLength(version, data.getType())};
+
+            appendBits(getBitLengthIndex(data.getType()), version - 1);
+            appendBits(static_cast<long>(data.size()), count_bits);
+
+            return data.size();
+        }
+
         appendBits(data.getTypeBits(), 4);
         appendBits(static_cast<long>(data.size()),
-                   getCountBitLength(analyzer.getVersion(), data.getType())
+                   getCountBitLength(version, data.getType())
                    );
 
         return data.size();
@@ -469,6 +513,20 @@ namespace Qrio {
                 - analyzer.getEccPerBlock() * analyzer.getEccBlocksCount();
     }
 
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of bits available for the data codewords,
+     *      the final data codeword of M1 & M3 is only 4 bits long.
+     */
+    int Encoder::getDataBitCount() const {
+        const bool half_codeword{analyzer.isMicro() and analyzer.getVersion() % 2 == 1};
+
+        return 8 * getDataCodewordsCount() - (half_codeword ? 4 : 0);
+    }
+
     /*
      * Pre-Conditions:
      *      None.
@@ -479,6 +537,10 @@ namespace Qrio {
     int Encoder::getVersionBitCount() const {
         const auto version{analyzer.getVersion()};
 
+        if (analyzer.isMicro()) {
+            return 8 * microCodewordsTable[version];
+        }
+
         int result = (16 * version + 128) * version + 64;
 
         if (2 <= version) {
@@ -494,29 +556,39 @@ namespace Qrio {
 
     /*
      * Pre-Conditions:
-     *      Data string.
+     *      None.
+     *
+     * Post-Conditions:
+     *      Appends the parity data for structured append to the stream,
+     *      the parity of the analyzer's data is used unless
+     *      the message parity is given.
+     *
+     * Check 8.3
+     */
+    void Encoder::appendParityData() {
+        appendBits(analyzer.struct_parity == -1 ? getParity(analyzer.getData())
+                                                : analyzer.struct_parity, 8);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string of the whole structured append message.
      *
      * Post-Conditions:
-     *      Generates the parity data for structured append,
-     *      then appends it to the stream.
+     *      Returns the 8-bit parity of the message,
+     *      double byte characters contribute both of their bytes.
      *
      * Check 8.3
      */
-    void Encoder::appendParityData(const wstring& data) {
+    int Encoder::getParity(const wstring& data) {
         int result{0};
 
         for (auto c: data) {
-            c = mapByteChar(c);
-
-            if (DataAnalyzer::isKanji(c)) {
-                result ^= c / (16 * 16);
-                result ^= c % (16 * 16);
-            } else {
-                result ^= c;
-            }
+            result ^= c / (16 * 16) % (16 * 16);
+            result ^= c % (16 * 16);
         }
 
-        appendBits(result, 8);
+        return result;
     }
 
     /*
@@ -533,7 +605,40 @@ namespace Qrio {
     void Encoder::appendSequenceIndicator() {
         appendBits(static_cast<int>(Designator::APPEND), 4);
         appendBits(analyzer.struct_id, 4);
-        appendBits(analyzer.struct_count, 4);
+        /* The count is stored as the number of symbols minus 1 */
+        appendBits(analyzer.struct_count - 1, 4);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Micro QR code.
+     *
+     * Post-Conditions:
+     *      Appends the terminator (3, 5, 7, or 9 bits) & the pad codewords,
+     *      the final 4-bit data codeword of M1 & M3 is padded with 0000.
+     *      Throws a domain error if the data exceeds the capacity.
+     *
+     * Check 7.4.9 & 7.4.10
+     */
+    void Encoder::appendMicroPadding() {
+        const auto capacity{static_cast<size_t>(getDataBitCount())};
+
+        if (capacity < size()) {
+            throw domain_error("Data too long for the Micro QR version");
+        }
+
+        /* Terminator, truncated if the capacity is reached */
+        appendBits(static_cast<int>(Designator::TERMINATOR),
+                   min(static_cast<size_t>(2 * analyzer.getVersion() + 1), capacity - size()));
+        appendBits(static_cast<int>(Designator::TERMINATOR),
+                   min((8 - size() % 8) % 8, capacity - size()));
+
+        // Pad with alternating bytes until the full codewords are filled
+        for (int padByte{0xEC}; size() + 8 <= capacity; padByte ^= 0xEC ^ 0x11)
+            appendBits(padByte, 8);
+
+        /* The final 4-bit codeword of M1 & M3 is 0000 */
+        appendBits(static_cast<int>(Designator::TERMINATOR), capacity - size());
     }
 
     /*
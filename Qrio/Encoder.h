@@ -32,7 +32,7 @@
 
 namespace Qrio {
     /*
-     * Encoder: 1.6.0
+     * Encoder: 1.7.0
      *
      * Encodes the DataSegments in the DataAnalyzer into a BitStream.
      * Encoding is done based on section 7, Annex H,
@@ -76,6 +76,28 @@ namespace Qrio {
          */
         [[nodiscard]] int getVersionBitCount() const;
 
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of bits available for the data codewords,
+         *      the final data codeword of M1 & M3 is only 4 bits long.
+         */
+        [[nodiscard]] int getDataBitCount() const;
+
+        /*
+         * Pre-Conditions:
+         *      Data string of the whole structured append message.
+         *
+         * Post-Conditions:
+         *      Returns the 8-bit parity of the message,
+         *      double byte characters contribute both of their bytes.
+         *
+         * Check 8.3
+         */
+        [[nodiscard]] static int getParity(const std::wstring&);
+
         /*
          * Pre-Conditions:
          *      None.
@@ -86,6 +108,16 @@ namespace Qrio {
          * Default constructor used temporarily by the QrCode class.
          */
         Encoder();
+
+        /*
+         * Pre-Conditions:
+         *      Version of the QrSymbol guaranteed in [1, 40].
+         *
+         * Post-Conditions:
+         *      Returns the number of bits in the character count indicator
+         *      for a QR code, based on the given version & mode type.
+         */
+        [[nodiscard]] static int getCountBitLength(int, Designator);
     private:
         /*
          * Used to determine whether we added the FNC1,
@@ -108,6 +140,32 @@ namespace Qrio {
             {8, 10, 12},    // Kanji
         };
 
+        /*
+         * Table for the number of bits in character count indicator for
+         * Micro QR code.
+         * Each row represents a mode indicator;
+         * each column represents a version (M1 to M4),
+         * 0 indicates that the mode is unavailable in the version.
+         *
+         * Based on Table 3 of ISO/IEC 18004:2015 page 23.
+         */
+        constexpr static int microCountBitLengthTable[4][4] {
+            {3, 4, 5, 6},   // Numeric
+            {0, 3, 4, 5},   // Alphanumeric
+            {0, 0, 4, 5},   // Byte
+            {0, 0, 3, 4},   // Kanji
+        };
+
+        /*
+         * Total number of codewords in a Micro QR code.
+         * Index 0 is for padding, and is set to an illegal value.
+         *
+         * Based on Table 7 of ISO/IEC 18004:2015.
+         */
+        constexpr static int microCodewordsTable[5] {
+            -1, 5, 10, 17, 24
+        };
+
         /*
          * Pre-Conditions:
          *      Constant reference to DataSegment.
@@ -191,13 +249,14 @@ namespace Qrio {
 
         /*
          * Pre-Conditions:
-         *      Version of the QrSymbol guaranteed in [1, 40].
+         *      Version of the Micro QR symbol guaranteed in [1, 4].
          *
          * Post-Conditions:
          *      Returns the number of bits in the character count indicator
-         *      for a QR code, based on the given version & mode type.
+         *      for a Micro QR code, based on the given version & mode type.
+         *      Throws a domain error if the mode is unavailable in the version.
          */
-        [[nodiscard]] static int getCountBitLength(int, Designator);
+        [[nodiscard]] static int getMicroCountBitLength(int, Designator);
 
         /*
          * Pre-Conditions:
@@ -260,12 +319,13 @@ namespace Qrio {
          *      None.
          *
          * Post-Conditions:
-         *      Generates the parity data for structured append,
-         *      then appends it to the stream.
+         *      Appends the parity data for structured append to the stream,
+         *      the parity of the analyzer's data is used unless
+         *      the message parity is given.
          *
          * Check 8.3
          */
-        void appendParityData(const std::wstring&);
+        void appendParityData();
 
         /*
          * Pre-Conditions:
@@ -279,6 +339,19 @@ namespace Qrio {
          * Check 8.2
          */
         void appendSequenceIndicator();
+
+        /*
+         * Pre-Conditions:
+         *      Micro QR code.
+         *
+         * Post-Conditions:
+         *      Appends the terminator (3, 5, 7, or 9 bits) & the pad codewords,
+         *      the final 4-bit data codeword of M1 & M3 is padded with 0000.
+         *      Throws a domain error if the data exceeds the capacity.
+         *
+         * Check 7.4.9 & 7.4.10
+         */
+        void appendMicroPadding();
     };
 }
 
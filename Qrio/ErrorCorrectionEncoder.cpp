@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "ErrorCorrectionEncoder.h"
+#include "Profiler.h"
 
 
 namespace Qrio {
@@ -36,6 +37,8 @@ namespace Qrio {
 
     ErrorCorrectionEncoder::ErrorCorrectionEncoder(const Encoder& encoder):
     encoder{encoder} {
+        QRIO_PROFILE_STAGE(Stage::ERROR_CORRECTION);
+
         assert(static_cast<int>(encoder.codewords.size())
                 == encoder.getDataCodewordsCount());
         appendEccAndInterleave();
@@ -203,10 +206,16 @@ namespace Qrio {
      * Post-Conditions:
      *      Returns the size of the QR matrix.
      *
-     * Check 6.3.2.1
+     * Check 6.3.2.1 & 6.3.2.2
      */
     size_t ErrorCorrectionEncoder::getMatrixSize() const {
-        return 17 + 4 * encoder.analyzer.getVersion();
+        const auto version{encoder.analyzer.getVersion()};
+
+        if (encoder.analyzer.isMicro()) {
+            return 9 + 2 * version;
+        }
+
+        return 17 + 4 * version;
     }
 
     /*
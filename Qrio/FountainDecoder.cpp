@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "FountainDecoder.h"
+#include "FountainEncoder.h"
+
+
+namespace Qrio {
+    using std::domain_error, std::invalid_argument, std::vector, std::pair, std::find, std::min, std::move;
+
+    /*
+     * Pre-Conditions:
+     *      Received packet.
+     *
+     * Post-Conditions:
+     *      Adds the packet & recovers every chunk it makes solvable.
+     *      Returns true if the file is complete.
+     *      Throws an invalid argument exception if the packet has no chunks,
+     *      if its file size exceeds its chunks (count times the payload size of full chunks),
+     *      or if its chunk count or file size differ from the earlier packets.
+     */
+    bool FountainDecoder::add(const FramePacket& packet) {
+        if (packet.count == 0) {
+            throw invalid_argument("Packet has no chunks");
+        }
+
+        /* Fountain symbols & every chunk but the last have the chunk size, the file must fit in the chunks */
+        const bool full{packet.type != PacketType::CHUNK or packet.sequence + 1 < packet.count or packet.count == 1};
+
+        if (full and packet.file_size > uint64_t{packet.count} * packet.payload.size()) {
+            throw invalid_argument("Packet file size exceeds its chunks");
+        }
+
+        if (received == 0) {
+            count = packet.count;
+            file_size = packet.file_size;
+            chunks.resize(count);
+            known.resize(count, false);
+            waiting.resize(count);
+        } else if (packet.count != count or packet.file_size != file_size) {
+            throw invalid_argument("Packet belongs to another file");
+        }
+
+        received++;
+
+        if (isComplete()) {
+            return true;
+        }
+
+        if (packet.type == PacketType::CHUNK) {
+            if (packet.sequence >= count) {
+                throw invalid_argument("Chunk index is out of range");
+            }
+
+            recover(packet.sequence, vector<uint8_t>{packet.payload});
+
+            return isComplete();
+        }
+
+        if (chunk_size == 0) {
+            chunk_size = packet.payload.size();
+            distribution = FountainEncoder::getDistribution(count);
+        } else if (packet.payload.size() != chunk_size) {
+            throw invalid_argument("Packet belongs to another file");
+        }
+
+        Pending symbol{{}, packet.payload};
+
+        /* XOR out the chunks already known */
+        for (uint32_t index: FountainEncoder::getIndices(packet.sequence, count, distribution)) {
+            if (not known[index]) {
+                symbol.indices.push_back(index);
+                continue;
+            }
+
+            const size_t length{min(chunks[index].size(), chunk_size)};
+
+            for (size_t i{0}; i < length; i++) {
+                symbol.payload[i] ^= chunks[index][i];
+            }
+        }
+
+        if (symbol.indices.size() == 1) {
+            recover(symbol.indices[0], move(symbol.payload));
+        } else if (not symbol.indices.empty()) {
+            for (uint32_t index: symbol.indices) {
+                waiting[index].push_back(pending.size());
+            }
+
+            pending.push_back(move(symbol));
+        }
+
+        return isComplete();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns true if every chunk is recovered.
+     */
+    bool FountainDecoder::isComplete() const {
+        return received > 0 and recovered == count;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of packets added.
+     */
+    size_t FountainDecoder::getReceived() const {
+        return received;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of chunks recovered so far.
+     */
+    size_t FountainDecoder::getRecovered() const {
+        return recovered;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the file bytes.
+     *      Throws a domain error exception if the file is not complete.
+     */
+    vector<uint8_t> FountainDecoder::getData() const {
+        if (not isComplete()) {
+            throw domain_error("File is not complete");
+        }
+
+        vector<uint8_t> result{};
+
+        result.reserve(file_size);
+
+        for (const auto& chunk: chunks) {
+            const size_t length{min(chunk.size(), file_size - result.size())};
+
+            result.insert(result.end(), chunk.begin(), chunk.begin() + static_cast<ptrdiff_t>(length));
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Index of a missing chunk,
+     *      its bytes.
+     *
+     * Post-Conditions:
+     *      Stores the chunk & peels it off the pending symbols,
+     *      until no pending symbol is left with a single missing chunk.
+     */
+    void FountainDecoder::recover(uint32_t index, vector<uint8_t>&& bytes) {
+        vector<pair<uint32_t, vector<uint8_t>>> stack{};
+
+        stack.emplace_back(index, move(bytes));
+
+        while (not stack.empty()) {
+            auto [current, chunk]{move(stack.back())};
+
+            stack.pop_back();
+
+            if (known[current]) {
+                continue;
+            }
+
+            known[current] = true;
+            chunks[current] = move(chunk);
+            recovered++;
+
+            for (size_t position: waiting[current]) {
+                Pending& symbol{pending[position]};
+
+                if (symbol.indices.empty()) {
+                    continue;
+                }
+
+                const size_t length{min(chunks[current].size(), chunk_size)};
+
+                for (size_t i{0}; i < length; i++) {
+                    symbol.payload[i] ^= chunks[current][i];
+                }
+
+                symbol.indices.erase(find(symbol.indices.begin(), symbol.indices.end(), current));
+
+                if (symbol.indices.size() == 1) {
+                    stack.emplace_back(symbol.indices[0], move(symbol.payload));
+                    symbol.indices.clear();
+                }
+            }
+
+            waiting[current].clear();
+        }
+    }
+}
@@ -0,0 +1,150 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_FOUNTAINDECODER_H
+#define QR_IO_FOUNTAINDECODER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "FramePacket.h"
+
+
+namespace Qrio {
+    /*
+     * FountainDecoder: 1.0
+     *
+     * Offline receiver of frame streams, accepts chunk & fountain packets in any order,
+     * with losses & duplicates, & rebuilds the file by peeling (belief propagation).
+     * Used to measure the recovery rate & throughput of lossy transfers.
+     */
+    class FountainDecoder final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Decoder waiting for its first packet.
+         */
+        FountainDecoder() = default;
+
+        /*
+         * Pre-Conditions:
+         *      Received packet.
+         *
+         * Post-Conditions:
+         *      Adds the packet & recovers every chunk it makes solvable.
+         *      Returns true if the file is complete.
+         *      Throws an invalid argument exception if the packet has no chunks,
+         *      if its file size exceeds its chunks (count times the payload size of full chunks),
+         *      or if its chunk count or file size differ from the earlier packets.
+         */
+        bool add(const FramePacket&);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns true if every chunk is recovered.
+         */
+        [[nodiscard]] bool isComplete() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of packets added.
+         */
+        [[nodiscard]] size_t getReceived() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of chunks recovered so far.
+         */
+        [[nodiscard]] size_t getRecovered() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the file bytes.
+         *      Throws a domain error exception if the file is not complete.
+         */
+        [[nodiscard]] std::vector<uint8_t> getData() const;
+
+    private:
+        /*
+         * Symbol waiting for some of its chunks.
+         */
+        class Pending final {
+        public:
+            /* Unrecovered chunks XORed into the payload */
+            std::vector<uint32_t> indices;
+
+            std::vector<uint8_t> payload;
+        };
+
+        size_t received{0};
+
+        size_t recovered{0};
+
+        size_t chunk_size{0};
+
+        uint32_t count{0};
+
+        uint32_t file_size{0};
+
+        std::vector<uint32_t> distribution{};
+
+        /* Recovered chunks */
+        std::vector<std::vector<uint8_t>> chunks{};
+
+        std::vector<bool> known{};
+
+        std::vector<Pending> pending{};
+
+        /* Pending symbols referencing each chunk */
+        std::vector<std::vector<size_t>> waiting{};
+
+        /*
+         * Pre-Conditions:
+         *      Index of a missing chunk,
+         *      its bytes.
+         *
+         * Post-Conditions:
+         *      Stores the chunk & peels it off the pending symbols,
+         *      until no pending symbol is left with a single missing chunk.
+         */
+        void recover(uint32_t, std::vector<uint8_t>&&);
+    };
+}
+
+
+#endif //QR_IO_FOUNTAINDECODER_H
@@ -0,0 +1,213 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "FountainEncoder.h"
+
+
+namespace Qrio {
+    using std::invalid_argument, std::vector, std::lower_bound, std::sort, std::find, std::iota,
+            std::accumulate, std::min, std::max, std::swap, std::log, std::sqrt, std::floor, std::llround;
+
+    /*
+     * Pre-Conditions:
+     *      Data, which must outlive the encoder,
+     *      size of the data in bytes (below 4 GiB),
+     *      bytes per chunk (positive).
+     *
+     * Post-Conditions:
+     *      Splits the data into chunks, the last one is padded with zeros.
+     *      Throws an invalid argument exception if the chunk size is 0.
+     */
+    FountainEncoder::FountainEncoder(const uint8_t* data, size_t size, size_t chunk_size) :
+            data{data}, size{size}, chunk_size{chunk_size}, count{0} {
+        if (chunk_size == 0) {
+            throw invalid_argument("Fountain chunk size must be positive");
+        }
+
+        count = static_cast<uint32_t>(max(size_t{1}, (size + chunk_size - 1) / chunk_size));
+        distribution = getDistribution(count);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of chunks (k).
+     */
+    uint32_t FountainEncoder::getChunkCount() const {
+        return count;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Seed of the symbol.
+     *
+     * Post-Conditions:
+     *      Returns the fountain packet of the symbol, its payload is one chunk long.
+     */
+    FramePacket FountainEncoder::getPacket(uint32_t seed) const {
+        FramePacket result{};
+
+        result.type = PacketType::FOUNTAIN;
+        result.sequence = seed;
+        result.count = count;
+        result.file_size = static_cast<uint32_t>(size);
+        result.payload.assign(chunk_size, 0);
+
+        for (uint32_t index: getIndices(seed, count, distribution)) {
+            const size_t start{index * chunk_size};
+            const size_t end{min(start + chunk_size, size)};
+
+            for (size_t i{start}; i < end; i++) {
+                result.payload[i - start] ^= data[i];
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Seed of the symbol,
+     *      number of chunks,
+     *      cumulative degree distribution returned by getDistribution.
+     *
+     * Post-Conditions:
+     *      Returns the sorted distinct indices of the chunks XORed into the symbol.
+     *      Seeds below k select their own chunk.
+     *      Small degrees are drawn by rejection, large ones by a partial Fisher-Yates shuffle.
+     */
+    vector<uint32_t> FountainEncoder::getIndices(uint32_t seed, uint32_t count,
+                                                 const vector<uint32_t>& distribution) {
+        if (seed < count) {
+            return {seed};
+        }
+
+        uint64_t state{static_cast<uint64_t>(seed) << 32 | count};
+
+        /* Multiply shift maps 32 random bits onto [0, n[ */
+        const auto draw{[&state](uint32_t n) {
+            return static_cast<uint32_t>((getRandom(state) >> 32) * n >> 32);
+        }};
+
+        const uint32_t sample{static_cast<uint32_t>(getRandom(state) >> 32)};
+        const uint32_t degree{static_cast<uint32_t>(
+                lower_bound(distribution.begin(), distribution.end(), sample) - distribution.begin()) + 1};
+
+        vector<uint32_t> result{};
+
+        if (degree * 4 <= count) {
+            while (result.size() < degree) {
+                const uint32_t index{draw(count)};
+
+                if (find(result.begin(), result.end(), index) == result.end()) {
+                    result.push_back(index);
+                }
+            }
+        } else {
+            vector<uint32_t> indices(count);
+
+            iota(indices.begin(), indices.end(), 0);
+
+            for (uint32_t i{0}; i < min(degree, count); i++) {
+                swap(indices[i], indices[i + draw(count - i)]);
+            }
+
+            result.assign(indices.begin(), indices.begin() + min(degree, count));
+        }
+
+        sort(result.begin(), result.end());
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Number of chunks (positive).
+     *
+     * Post-Conditions:
+     *      Returns the cumulative robust soliton distribution of the degrees 1 to k,
+     *      scaled to 2^32 - 1 & rounded to integers, the last entry is always 2^32 - 1.
+     *
+     * Check Luby, "LT Codes", 2002, with c = 0.03 & delta = 0.5.
+     */
+    vector<uint32_t> FountainEncoder::getDistribution(uint32_t count) {
+        const double C{0.03}, DELTA{0.5};
+        const double k{static_cast<double>(count)};
+        const double R{C * log(k / DELTA) * sqrt(k)};
+        const double spike{R > 0 ? floor(k / R) : 0};
+
+        vector<double> weights(count, 0);
+
+        for (uint32_t d{1}; d <= count; d++) {
+            /* Ideal soliton */
+            double weight{d == 1 ? 1 / k : 1 / (static_cast<double>(d) * (d - 1))};
+
+            /* Robust part, extra low degrees & a spike at k / R */
+            if (d < spike) {
+                weight += R / (d * k);
+            } else if (d == spike) {
+                weight += R * log(R / DELTA) / k;
+            }
+
+            weights[d - 1] = weight;
+        }
+
+        const double total{accumulate(weights.begin(), weights.end(), 0.0)};
+        vector<uint32_t> result(count);
+        double sum{0};
+
+        for (uint32_t d{0}; d < count; d++) {
+            sum += weights[d];
+            result[d] = static_cast<uint32_t>(llround(min(sum / total, 1.0) * 4294967295.0));
+        }
+
+        result.back() = 0xFFFFFFFF;
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Generator state.
+     *
+     * Post-Conditions:
+     *      Advances the state & returns the next 64 bit output (SplitMix64).
+     */
+    uint64_t FountainEncoder::getRandom(uint64_t& state) {
+        uint64_t result{state += 0x9E3779B97F4A7C15};
+
+        result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9;
+        result = (result ^ (result >> 27)) * 0x94D049BB133111EB;
+
+        return result ^ (result >> 31);
+    }
+}
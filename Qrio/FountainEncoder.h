@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_FOUNTAINENCODER_H
+#define QR_IO_FOUNTAINENCODER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "FramePacket.h"
+
+
+namespace Qrio {
+    /*
+     * FountainEncoder: 1.0
+     *
+     * Rateless LT code over the chunks of a file, for loss tolerant frame streams.
+     * Any seed gives a symbol: the first k seeds are the k chunks themselves (systematic),
+     * the others XOR a robust soliton distributed number of chunks chosen from the seed.
+     * A receiver needs slightly more than k distinct symbols, whichever they are.
+     * The chunks are drawn with a portable generator (SplitMix64) from an integer
+     * distribution table, so the encoder & the decoder agree on every platform.
+     */
+    class FountainEncoder final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Data, which must outlive the encoder,
+         *      size of the data in bytes (below 4 GiB),
+         *      bytes per chunk (positive).
+         *
+         * Post-Conditions:
+         *      Splits the data into chunks, the last one is padded with zeros.
+         *      Throws an invalid argument exception if the chunk size is 0.
+         */
+        FountainEncoder(const uint8_t*, size_t, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of chunks (k).
+         */
+        [[nodiscard]] uint32_t getChunkCount() const;
+
+        /*
+         * Pre-Conditions:
+         *      Seed of the symbol.
+         *
+         * Post-Conditions:
+         *      Returns the fountain packet of the symbol, its payload is one chunk long.
+         */
+        [[nodiscard]] FramePacket getPacket(uint32_t) const;
+
+        /*
+         * Pre-Conditions:
+         *      Seed of the symbol,
+         *      number of chunks,
+         *      cumulative degree distribution returned by getDistribution.
+         *
+         * Post-Conditions:
+         *      Returns the sorted distinct indices of the chunks XORed into the symbol.
+         *      Seeds below k select their own chunk.
+         *      Small degrees are drawn by rejection, large ones by a partial Fisher-Yates shuffle.
+         */
+        [[nodiscard]] static std::vector<uint32_t> getIndices(uint32_t, uint32_t, const std::vector<uint32_t>&);
+
+        /*
+         * Pre-Conditions:
+         *      Number of chunks (positive).
+         *
+         * Post-Conditions:
+         *      Returns the cumulative robust soliton distribution of the degrees 1 to k,
+         *      scaled to 2^32 - 1 & rounded to integers, the last entry is always 2^32 - 1.
+         */
+        [[nodiscard]] static std::vector<uint32_t> getDistribution(uint32_t);
+
+    private:
+        const uint8_t* data;
+
+        size_t size;
+
+        size_t chunk_size;
+
+        uint32_t count;
+
+        /* Cumulative degree distribution */
+        std::vector<uint32_t> distribution;
+
+        /*
+         * Pre-Conditions:
+         *      Generator state.
+         *
+         * Post-Conditions:
+         *      Advances the state & returns the next 64 bit output (SplitMix64).
+         */
+        static uint64_t getRandom(uint64_t&);
+    };
+}
+
+
+#endif //QR_IO_FOUNTAINENCODER_H
@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_FRAMEOPTIONS_H
+#define QR_IO_FRAMEOPTIONS_H
+
+#include <cstddef>
+
+#include "Ecl.h"
+#include "MaskPolicy.h"
+
+
+namespace Qrio {
+    /*
+     * FrameOptions: 1.0
+     *
+     * Describes how a file is split into the QR frames of an animated stream.
+     */
+    class FrameOptions final {
+    public:
+        /* File bytes per frame, the version is the smallest one fitting a full frame */
+        size_t chunk_size{400};
+
+        /* Error correction level of the frames */
+        Ecl ecl{Ecl::M};
+
+        /* Mask selection of the frames */
+        MaskPolicy mask_policy{MaskPolicy::FAST};
+
+        /* Frames encoded concurrently, 0 for twice the hardware concurrency */
+        size_t window{0};
+
+        /* Fountain code the frames, so a receiver can skip lost frames instead of waiting for them */
+        bool fountain{false};
+
+        /* Extra fountain frames as a fraction of the number of chunks */
+        double redundancy{0.5};
+    };
+}
+
+
+#endif //QR_IO_FRAMEOPTIONS_H
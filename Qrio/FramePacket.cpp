@@ -0,0 +1,105 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "BitmapWriter.h"
+#include "FramePacket.h"
+
+
+namespace Qrio {
+    using std::invalid_argument, std::vector;
+
+    /*
+     * Pre-Conditions:
+     *      Received bytes,
+     *      number of bytes.
+     *
+     * Post-Conditions:
+     *      Parses a packet written by toBytes.
+     *      Throws an invalid argument exception if the bytes are not a packet,
+     *      the checksum does not match, or a chunk index is out of range.
+     */
+    FramePacket::FramePacket(const uint8_t* data, size_t size) {
+        const auto read{[data](size_t offset, int count) {
+            uint32_t value{0};
+
+            for (int i{0}; i < count; i++) {
+                value = value << 8 | data[offset + i];
+            }
+
+            return value;
+        }};
+
+        if (size < OVERHEAD or data[0] != 'Q' or data[1] != 'F'
+            or (data[2] != static_cast<uint8_t>(PacketType::CHUNK)
+                and data[2] != static_cast<uint8_t>(PacketType::FOUNTAIN))) {
+            throw invalid_argument("Not a frame packet");
+        }
+
+        if (BitmapWriter::getCrc(data, size - 4) != read(size - 4, 4)) {
+            throw invalid_argument("Frame packet checksum mismatch");
+        }
+
+        type = static_cast<PacketType>(data[2]);
+        sequence = read(3, 4);
+        count = read(7, 4);
+        file_size = read(11, 4);
+        payload.assign(data + OVERHEAD - 4, data + size - 4);
+
+        if (type == PacketType::CHUNK and sequence >= count) {
+            throw invalid_argument("Frame packet sequence out of range");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the framed packet.
+     */
+    vector<uint8_t> FramePacket::toBytes() const {
+        vector<uint8_t> result{'Q', 'F', static_cast<uint8_t>(type)};
+
+        result.reserve(OVERHEAD + payload.size());
+
+        for (uint32_t value: {sequence, count, file_size}) {
+            for (int shift{24}; shift >= 0; shift -= 8) {
+                result.push_back(static_cast<uint8_t>(value >> shift));
+            }
+        }
+
+        result.insert(result.end(), payload.begin(), payload.end());
+
+        const uint32_t crc{BitmapWriter::getCrc(result.data(), result.size())};
+
+        for (int shift{24}; shift >= 0; shift -= 8) {
+            result.push_back(static_cast<uint8_t>(crc >> shift));
+        }
+
+        return result;
+    }
+}
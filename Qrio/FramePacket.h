@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_FRAMEPACKET_H
+#define QR_IO_FRAMEPACKET_H
+
+#include <cstdint>
+#include <vector>
+
+#include "PacketType.h"
+
+
+namespace Qrio {
+    /*
+     * FramePacket: 1.0
+     *
+     * Chunk of a file, or fountain coded symbol, carried by one QR frame of an animated stream.
+     * Binary layout (big endian): 'Q' 'F', packet type, sequence number (chunk index or seed),
+     * number of chunks, file size, payload, then the CRC-32 of all the preceding bytes.
+     * The receiver can reassemble the file in any order & detect corrupted frames.
+     */
+    class FramePacket final {
+    public:
+        /* Size of the header & checksum around the chunk bytes */
+        const static size_t OVERHEAD{19};
+
+        /* Kind of payload */
+        PacketType type{PacketType::CHUNK};
+
+        /* Index of the chunk, or seed of the fountain symbol */
+        uint32_t sequence{0};
+
+        /* Number of chunks of the file */
+        uint32_t count{0};
+
+        /* Size of the whole file in bytes */
+        uint32_t file_size{0};
+
+        /* Chunk bytes, or XOR of the chunks of the fountain symbol */
+        std::vector<uint8_t> payload{};
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Empty packet.
+         */
+        FramePacket() = default;
+
+        /*
+         * Pre-Conditions:
+         *      Received bytes,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Parses a packet written by toBytes.
+         *      Throws an invalid argument exception if the bytes are not a packet,
+         *      the checksum does not match, or a chunk index is out of range.
+         */
+        FramePacket(const uint8_t*, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the framed packet.
+         */
+        [[nodiscard]] std::vector<uint8_t> toBytes() const;
+    };
+}
+
+
+#endif //QR_IO_FRAMEPACKET_H
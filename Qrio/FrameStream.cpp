@@ -0,0 +1,287 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "FrameStream.h"
+
+
+namespace Qrio {
+    using std::string, std::wstring, std::vector, std::function, std::deque, std::future, std::async,
+            std::launch, std::pair, std::make_shared, std::max, std::min, std::snprintf, std::invalid_argument,
+            std::domain_error, std::length_error, std::ofstream, std::ios, std::thread, std::ceil;
+    using std::chrono::steady_clock, std::chrono::duration;
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the throughput in payload bytes per second.
+     */
+    double FrameStream::Stats::getBytesPerSecond() const {
+        return seconds > 0 ? static_cast<double>(bytes) / seconds : 0;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Path of the file,
+     *      optional frame options.
+     *
+     * Post-Conditions:
+     *      Maps the file & chooses the version of the frames.
+     *      Throws an invalid argument exception if the file cannot be read, the chunk size is 0
+     *      or the redundancy is negative,
+     *      & a length error if the file exceeds 4 GiB or a frame exceeds version 40.
+     */
+    FrameStream::FrameStream(const string& path, const FrameOptions& options) :
+            file{make_shared<const MappedFile>(path)}, options{options} {
+        data = file->data();
+        size = file->size();
+        initialize();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data, which must outlive the stream,
+     *      size of the data in bytes,
+     *      optional frame options.
+     *
+     * Post-Conditions:
+     *      Chooses the version of the frames.
+     *      Throws an invalid argument exception if the chunk size is 0 or the redundancy is negative,
+     *      & a length error if the data exceeds 4 GiB or a frame exceeds version 40.
+     */
+    FrameStream::FrameStream(const uint8_t* data, size_t size, const FrameOptions& options) :
+            data{data}, size{size}, options{options} {
+        initialize();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of frames, the chunks plus the redundancy for fountain streams.
+     *      An empty file still takes one frame.
+     */
+    size_t FrameStream::getFrameCount() const {
+        const size_t chunks{max(size_t{1}, (size + options.chunk_size - 1) / options.chunk_size)};
+
+        if (not fountain) {
+            return chunks;
+        }
+
+        return chunks + static_cast<size_t>(ceil(static_cast<double>(chunks) * options.redundancy));
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the version shared by all the frames.
+     */
+    int FrameStream::getVersion() const {
+        return version;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Frame index in [0, frame count[.
+     *
+     * Post-Conditions:
+     *      Returns the packet carried by the frame.
+     */
+    FramePacket FrameStream::getPacket(size_t index) const {
+        if (fountain) {
+            return fountain->getPacket(static_cast<uint32_t>(index));
+        }
+
+        const size_t start{min(index * options.chunk_size, size)};
+        const size_t end{min(start + options.chunk_size, size)};
+
+        FramePacket result{};
+
+        result.sequence = static_cast<uint32_t>(index);
+        result.count = static_cast<uint32_t>(getFrameCount());
+        result.file_size = static_cast<uint32_t>(size);
+        result.payload.assign(data + start, data + end);
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Frame index in [0, frame count[.
+     *
+     * Post-Conditions:
+     *      Returns the QR code of the frame.
+     */
+    QrCode FrameStream::getFrame(size_t index) const {
+        return makeFrame(getPacket(index).toBytes(), options.ecl, version, options.mask_policy);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Sink taking the frame index & its QR code.
+     *
+     * Post-Conditions:
+     *      Encodes all the frames in parallel & passes them to the sink in order,
+     *      on the calling thread. Returns the statistics of the run.
+     *
+     * At most window frames are encoded or waiting for the sink at once,
+     * so the memory use does not depend on the size of the file.
+     */
+    FrameStream::Stats FrameStream::encode(const function<void(size_t, const QrCode&)>& sink) const {
+        const auto start{steady_clock::now()};
+        const size_t N{getFrameCount()};
+        const size_t window{options.window != 0 ? options.window
+                                                : 2 * max(1u, thread::hardware_concurrency())};
+
+        /* Each frame comes with the payload size of its packet, so the packet is built once */
+        deque<future<pair<QrCode, size_t>>> in_flight{};
+        Stats result{};
+
+        const auto deliver{[&]() {
+            const auto [frame, payload]{in_flight.front().get()};
+
+            in_flight.pop_front();
+            sink(result.frames, frame);
+            result.bytes += payload;
+            result.frames++;
+        }};
+
+        for (size_t i{0}; i < N; i++) {
+            if (in_flight.size() == window) {
+                deliver();
+            }
+
+            in_flight.push_back(async(launch::async, [this, i]() {
+                const FramePacket packet{getPacket(i)};
+
+                return pair{makeFrame(packet.toBytes(), options.ecl, version, options.mask_policy),
+                            packet.payload.size()};
+            }));
+        }
+
+        while (not in_flight.empty()) {
+            deliver();
+        }
+
+        result.seconds = duration<double>(steady_clock::now() - start).count();
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Path prefix of the images,
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Saves the frames as the PNG images <prefix>000000.png, <prefix>000001.png, ...
+     *      Returns the statistics of the run.
+     *      Throws an invalid argument exception if an image cannot be created,
+     *      & a domain error if it cannot be written.
+     */
+    FrameStream::Stats FrameStream::saveImages(const string& prefix, const RenderOptions& render_options) const {
+        return encode([&](size_t index, const QrCode& frame) {
+            char name[16];
+
+            snprintf(name, sizeof(name), "%06zu.png", index);
+
+            ofstream image{prefix + name, ios::binary};
+
+            if (not image) {
+                throw invalid_argument("Cannot create image file: " + prefix + name);
+            }
+
+            frame.render(image, ImageFormat::PNG, render_options);
+            image.close();
+
+            if (not image) {
+                throw domain_error("Image file could not be written: " + prefix + name);
+            }
+        });
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Packet bytes,
+     *      error correction level,
+     *      version (-1 for auto),
+     *      mask policy.
+     *
+     * Post-Conditions:
+     *      Returns the QR code carrying the bytes in a single byte mode segment.
+     */
+    QrCode FrameStream::makeFrame(const vector<uint8_t>& bytes, Ecl ecl, int version, MaskPolicy mask_policy) {
+        const wstring text(bytes.begin(), bytes.end());
+
+        return QrCode{SegmentList{{Designator::BYTE, text}}, ecl, version, -1, 0, -1, -1, mask_policy};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Checks the options & the size, then chooses the version of the frames
+     *      as the smallest one fitting a full chunk. Fountain symbols are one chunk long too.
+     */
+    void FrameStream::initialize() {
+        if (options.chunk_size == 0) {
+            throw invalid_argument("Frame chunk size must be positive");
+        }
+
+        if (options.redundancy < 0) {
+            throw invalid_argument("Frame redundancy must not be negative");
+        }
+
+        if (size > 0xFFFFFFFFull) {
+            throw length_error("Frame streams are limited to 4 GiB");
+        }
+
+        if (options.fountain) {
+            fountain = make_shared<const FountainEncoder>(data, size, options.chunk_size);
+        }
+
+        const vector<uint8_t> full(FramePacket::OVERHEAD + options.chunk_size, 0);
+
+        version = makeFrame(full, options.ecl, -1, options.mask_policy).getVersion();
+    }
+}
@@ -0,0 +1,205 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_FRAMESTREAM_H
+#define QR_IO_FRAMESTREAM_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "FountainEncoder.h"
+#include "FrameOptions.h"
+#include "FramePacket.h"
+#include "MappedFile.h"
+#include "QrCode.h"
+#include "RenderOptions.h"
+
+
+namespace Qrio {
+    /*
+     * FrameStream: 1.0
+     *
+     * Turns a file of any size into a sequence of QR frames (screen to camera transfer),
+     * beyond the 16 symbols of structured append. The file is memory mapped & cut into
+     * framed packets, all frames share one version so they can form a video.
+     * Frames are encoded in parallel, at most a window of them is in flight at once,
+     * & they are delivered in order.
+     * With the fountain option the frames carry LT coded symbols instead of the plain chunks,
+     * & a receiver rebuilds the file from any set of slightly more frames than chunks.
+     */
+    class FrameStream final {
+    public:
+        /*
+         * Statistics of an encoding run.
+         */
+        class Stats final {
+        public:
+            /* Number of frames delivered */
+            size_t frames{0};
+
+            /*
+             * Number of payload bytes carried by the frames, the file bytes of plain streams,
+             * or the symbol bytes of fountain streams (a chunk per frame, redundancy included)
+             */
+            size_t bytes{0};
+
+            /* Wall clock time in seconds */
+            double seconds{0};
+
+            /*
+             * Pre-Conditions:
+             *      None.
+             *
+             * Post-Conditions:
+             *      Returns the throughput in payload bytes per second.
+             */
+            [[nodiscard]] double getBytesPerSecond() const;
+        };
+
+        /*
+         * Pre-Conditions:
+         *      Path of the file,
+         *      optional frame options.
+         *
+         * Post-Conditions:
+         *      Maps the file & chooses the version of the frames.
+         *      Throws an invalid argument exception if the file cannot be read, the chunk size is 0
+         *      or the redundancy is negative,
+         *      & a length error if the file exceeds 4 GiB or a frame exceeds version 40.
+         */
+        explicit FrameStream(const std::string&, const FrameOptions& options = FrameOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      Data, which must outlive the stream,
+         *      size of the data in bytes,
+         *      optional frame options.
+         *
+         * Post-Conditions:
+         *      Chooses the version of the frames.
+         *      Throws an invalid argument exception if the chunk size is 0 or the redundancy is negative,
+         *      & a length error if the data exceeds 4 GiB or a frame exceeds version 40.
+         */
+        FrameStream(const uint8_t*, size_t, const FrameOptions& options = FrameOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of frames, the chunks plus the redundancy for fountain streams.
+         */
+        [[nodiscard]] size_t getFrameCount() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the version shared by all the frames.
+         */
+        [[nodiscard]] int getVersion() const;
+
+        /*
+         * Pre-Conditions:
+         *      Frame index in [0, frame count[.
+         *
+         * Post-Conditions:
+         *      Returns the packet carried by the frame.
+         */
+        [[nodiscard]] FramePacket getPacket(size_t) const;
+
+        /*
+         * Pre-Conditions:
+         *      Frame index in [0, frame count[.
+         *
+         * Post-Conditions:
+         *      Returns the QR code of the frame.
+         */
+        [[nodiscard]] QrCode getFrame(size_t) const;
+
+        /*
+         * Pre-Conditions:
+         *      Sink taking the frame index & its QR code.
+         *
+         * Post-Conditions:
+         *      Encodes all the frames in parallel & passes them to the sink in order,
+         *      on the calling thread. Returns the statistics of the run.
+         */
+        Stats encode(const std::function<void(size_t, const QrCode&)>&) const;
+
+        /*
+         * Pre-Conditions:
+         *      Path prefix of the images,
+         *      optional render options.
+         *
+         * Post-Conditions:
+         *      Saves the frames as the PNG images <prefix>000000.png, <prefix>000001.png, ...
+         *      Returns the statistics of the run.
+         *      Throws an invalid argument exception if an image cannot be created,
+         *      & a domain error if it cannot be written.
+         */
+        Stats saveImages(const std::string&, const RenderOptions& options = RenderOptions{}) const;
+
+        /*
+         * Pre-Conditions:
+         *      Packet bytes,
+         *      error correction level,
+         *      version (-1 for auto),
+         *      mask policy.
+         *
+         * Post-Conditions:
+         *      Returns the QR code carrying the bytes in a single byte mode segment.
+         */
+        [[nodiscard]] static QrCode makeFrame(const std::vector<uint8_t>&, Ecl, int, MaskPolicy);
+
+    private:
+        /* Mapping of the file, null for caller data */
+        std::shared_ptr<const MappedFile> file{};
+
+        const uint8_t* data{nullptr};
+
+        size_t size{0};
+
+        FrameOptions options;
+
+        int version{0};
+
+        /* Symbol generator of fountain streams, null otherwise */
+        std::shared_ptr<const FountainEncoder> fountain{};
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Checks the options & the size, then chooses the version of the frames.
+         */
+        void initialize();
+    };
+}
+
+
+#endif //QR_IO_FRAMESTREAM_H
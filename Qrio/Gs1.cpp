@@ -0,0 +1,417 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Encoder.h"
+#include "Gs1.h"
+
+
+namespace Qrio {
+    using std::array, std::invalid_argument, std::pair, std::stoi, std::vector, std::wstring;
+
+    /*
+     * Pre-Conditions:
+     *      Element string, either in the bracketed form
+     *      "(01)09501101530003(10)AB-123", or in the raw form where
+     *      variable length values are followed by 0x1D
+     *      unless they are last.
+     *
+     * Post-Conditions:
+     *      Parses the element string.
+     *      Throws an invalid argument exception for unknown AIs,
+     *      values of the wrong length, or characters outside of
+     *      the GS1 character set 82.
+     */
+    Gs1::Gs1(const wstring& text) {
+        if (text.empty()) {
+            throw invalid_argument("Empty GS1 element string");
+        }
+
+        if (text[0] == L'(') {
+            parseBracketed(text);
+        } else {
+            parseRaw(text);
+        }
+
+        for (size_t i{0}; i < elements.size(); i++) {
+            const auto& [ai, value] {elements[i]};
+
+            data += ai + value;
+
+            /* Variable length values are terminated, unless they are last */
+            if (getPredefinedLength(stoi(ai.substr(0, 2))) == 0
+                and i + 1 < elements.size()) {
+                data += GROUP_SEPARATOR;
+            }
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the parsed (AI, value) pairs.
+     */
+    const vector<pair<wstring, wstring>>& Gs1::getElements() const {
+        return elements;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      QR version the segments are intended for.
+     *
+     * Post-Conditions:
+     *      Returns the segments of the element string with the
+     *      least number of bits for the given version.
+     *
+     * Costs are tracked in sixths of a bit, so that numeric (10 bits per 3)
+     * & alphanumeric (11 bits per 2) characters have integral costs.
+     */
+    SegmentList Gs1::getSegments(int version) const {
+        constexpr static array<Designator, 3> MODES{
+            Designator::NUMERIC, Designator::ALPHANUMERIC, Designator::BYTE
+        };
+
+        /* Cost of a mode indicator & character count indicator */
+        array<int, MODES.size()> header{};
+
+        for (size_t m{0}; m < MODES.size(); m++) {
+            header[m] = 6 * (4 + Encoder::getCountBitLength(version, MODES[m]));
+        }
+
+        /*
+         * cost[m] is the minimum cost of the data so far, ending in mode m,
+         * starting with the header of every mode.
+         */
+        array<int, MODES.size()> cost{header};
+
+        /* previous[i][m] is the mode of character i - 1 on the best path to mode m */
+        vector<array<size_t, MODES.size()>> previous(data.size());
+
+        for (size_t i{0}; i < data.size(); i++) {
+            array<int, MODES.size()> next{};
+
+            for (size_t m{0}; m < MODES.size(); m++) {
+                const int char_cost{getCost(MODES[m], data[i])};
+
+                next[m] = -1;
+
+                if (char_cost < 0) {
+                    continue;
+                }
+
+                for (size_t from{0}; from < MODES.size(); from++) {
+                    if (cost[from] < 0) {
+                        continue;
+                    }
+
+                    const int total{cost[from] + (from == m ? 0 : header[m]) + char_cost};
+
+                    if (next[m] < 0 or total < next[m]) {
+                        next[m] = total;
+                        previous[i][m] = from;
+                    }
+                }
+            }
+
+            cost = next;
+        }
+
+        size_t mode{0};
+
+        for (size_t m{1}; m < MODES.size(); m++) {
+            if (cost[m] >= 0 and (cost[mode] < 0 or cost[m] < cost[mode])) {
+                mode = m;
+            }
+        }
+
+        /* Trace back the mode of every character */
+        vector<size_t> char_modes(data.size());
+
+        for (size_t i{data.size()}; i-- > 0;) {
+            char_modes[i] = mode;
+            mode = previous[i][mode];
+        }
+
+        SegmentList result{};
+
+        for (size_t i{0}; i < data.size(); i++) {
+            const Designator current{MODES[char_modes[i]]};
+
+            if (i == 0 or char_modes[i] != char_modes[i - 1]) {
+                result.emplace_back(current, wstring{});
+            }
+
+            wstring& text{result.back().second};
+
+            if (current == Designator::ALPHANUMERIC) {
+                /* In FNC1 mode % represents the group separator, Check 7.4.8.1 */
+                if (data[i] == GROUP_SEPARATOR) {
+                    text += L'%';
+                } else if (data[i] == L'%') {
+                    text += L"%%";
+                } else {
+                    text += data[i];
+                }
+            } else {
+                text += data[i];
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      The first 2 digits of an AI.
+     *
+     * Post-Conditions:
+     *      Returns the number of digits of the AI,
+     *      or 0 if the prefix is unknown.
+     */
+    int Gs1::getAiLength(int prefix) {
+        if (prefix <= 22 or prefix == 30 or prefix == 37 or prefix >= 90) {
+            return 2;
+        }
+
+        if ((23 <= prefix and prefix <= 25) or (40 <= prefix and prefix <= 42)
+            or prefix == 71) {
+            return 3;
+        }
+
+        if ((31 <= prefix and prefix <= 36) or prefix == 39 or prefix == 43
+            or prefix == 70 or prefix == 72 or (80 <= prefix and prefix <= 82)) {
+            return 4;
+        }
+
+        return 0;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      The first 2 digits of an AI.
+     *
+     * Post-Conditions:
+     *      Returns the predefined length of the element string (AI & value),
+     *      or 0 if it has a variable length.
+     *
+     * Based on the predefined length table of the GS1 General Specifications.
+     */
+    int Gs1::getPredefinedLength(int prefix) {
+        switch (prefix) {
+            case 0:
+                return 20;
+            case 1:
+            case 2:
+            case 3:
+                return 16;
+            case 4:
+                return 18;
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+            case 18:
+            case 19:
+                return 8;
+            case 20:
+                return 4;
+            case 31:
+            case 32:
+            case 33:
+            case 34:
+            case 35:
+            case 36:
+                return 10;
+            case 41:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      A character c.
+     *
+     * Post-Conditions:
+     *      Returns true if the given character belongs to
+     *      the GS1 character set 82.
+     */
+    bool Gs1::isCharacterSet82(wchar_t c) {
+        return (L'0' <= c and c <= L'9') or (L'A' <= c and c <= L'Z')
+               or (L'a' <= c and c <= L'z')
+               or wstring{L"!\"%&'()*+,-./:;<=>?_"}.find(c) != wstring::npos;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      AI,
+     *      value of the AI.
+     *
+     * Post-Conditions:
+     *      Validates the element & appends it to the element list.
+     */
+    void Gs1::addElement(const wstring& ai, const wstring& value) {
+        if (ai.size() < 2 or not DataAnalyzer::isNumeric(ai)
+            or getAiLength(stoi(ai.substr(0, 2))) != static_cast<int>(ai.size())) {
+            throw invalid_argument("Unknown GS1 application identifier");
+        }
+
+        const int predefined{getPredefinedLength(stoi(ai.substr(0, 2)))};
+
+        if (predefined != 0) {
+            if (static_cast<int>(ai.size() + value.size()) != predefined
+                or not DataAnalyzer::isNumeric(value)) {
+                throw invalid_argument("GS1 value does not match its predefined length");
+            }
+        } else if (value.empty()) {
+            throw invalid_argument("Empty GS1 value");
+        }
+
+        for (wchar_t c: value) {
+            if (not isCharacterSet82(c)) {
+                throw invalid_argument("GS1 value contains a character outside of set 82");
+            }
+        }
+
+        elements.emplace_back(ai, value);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Element string in the bracketed form.
+     *
+     * Post-Conditions:
+     *      Parses the (AI)value pairs.
+     *      An opening bracket always starts a new AI.
+     */
+    void Gs1::parseBracketed(const wstring& text) {
+        size_t index{0};
+
+        while (index < text.size()) {
+            const size_t close{text.find(L')', index)};
+
+            if (text[index] != L'(' or close == wstring::npos) {
+                throw invalid_argument("Malformed bracketed GS1 element string");
+            }
+
+            size_t next{text.find(L'(', close)};
+
+            if (next == wstring::npos) {
+                next = text.size();
+            }
+
+            addElement(text.substr(index + 1, close - index - 1),
+                       text.substr(close + 1, next - close - 1));
+            index = next;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Element string in the raw form.
+     *
+     * Post-Conditions:
+     *      Parses the concatenated element strings.
+     */
+    void Gs1::parseRaw(const wstring& text) {
+        size_t index{0};
+
+        while (index < text.size()) {
+            /* Redundant separators after predefined length elements are dropped */
+            if (text[index] == GROUP_SEPARATOR) {
+                index++;
+                continue;
+            }
+
+            const wstring prefix{text.substr(index, 2)};
+
+            if (prefix.size() < 2 or not DataAnalyzer::isNumeric(prefix)) {
+                throw invalid_argument("Unknown GS1 application identifier");
+            }
+
+            const size_t ai_length{static_cast<size_t>(getAiLength(stoi(prefix)))};
+            const size_t predefined{static_cast<size_t>(getPredefinedLength(stoi(prefix)))};
+
+            if (ai_length == 0) {
+                throw invalid_argument("Unknown GS1 application identifier");
+            }
+
+            const wstring ai{text.substr(index, ai_length)};
+            size_t end;
+
+            if (predefined != 0) {
+                end = index + predefined;
+            } else {
+                end = text.find(GROUP_SEPARATOR, index + ai_length);
+                end = end == wstring::npos ? text.size() : end;
+            }
+
+            if (end > text.size()) {
+                throw invalid_argument("GS1 value does not match its predefined length");
+            }
+
+            addElement(ai, text.substr(index + ai_length, end - index - ai_length));
+            index = end;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Mode,
+     *      character of the data.
+     *
+     * Post-Conditions:
+     *      Returns the cost of the character in the mode in sixths of a bit,
+     *      or -1 if the mode cannot encode it.
+     */
+    int Gs1::getCost(Designator mode, wchar_t c) {
+        switch (mode) {
+            case Designator::NUMERIC:
+                return L'0' <= c and c <= L'9' ? 20 : -1;
+            case Designator::ALPHANUMERIC:
+                if (c == GROUP_SEPARATOR) {
+                    return 33;
+                }
+
+                if (c == L'%') {
+                    return 66;
+                }
+
+                return DataAnalyzer::isNumeric(wstring(1, c))
+                       or DataAnalyzer::isAlphanumeric(wstring(1, c)) ? 33 : -1;
+            default:
+                return 48;
+        }
+    }
+}
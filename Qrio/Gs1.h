@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_GS1_H
+#define QR_IO_GS1_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataAnalyzer.h"
+#include "Designator.h"
+
+
+namespace Qrio {
+    /*
+     * Gs1: 1.0
+     *
+     * Parses GS1 element strings into their Application Identifiers (AIs)
+     * & values, then segments them into the cheapest sequence of
+     * numeric, alphanumeric, & byte segments for an FNC1 (1st position) QR code.
+     * Group separators are encoded as % in alphanumeric mode
+     * (a literal % is doubled) & as 0x1D in byte mode.
+     *
+     * Check 7.4.8 & the GS1 General Specifications.
+     */
+    class Gs1 final {
+    public:
+        /* Group separator (FNC1) terminating variable length values */
+        const static wchar_t GROUP_SEPARATOR{0x1D};
+
+        /*
+         * Pre-Conditions:
+         *      Element string, either in the bracketed form
+         *      "(01)09501101530003(10)AB-123", or in the raw form where
+         *      variable length values are followed by 0x1D
+         *      unless they are last.
+         *
+         * Post-Conditions:
+         *      Parses the element string.
+         *      Throws an invalid argument exception for unknown AIs,
+         *      values of the wrong length, or characters outside of
+         *      the GS1 character set 82.
+         */
+        explicit Gs1(const std::wstring&);
+
+        /*
+         * Pre-Conditions:
+         *      QR version the segments are intended for.
+         *
+         * Post-Conditions:
+         *      Returns the segments of the element string with the
+         *      least number of bits for the given version.
+         */
+        [[nodiscard]] SegmentList getSegments(int) const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the parsed (AI, value) pairs.
+         */
+        [[nodiscard]] const std::vector<std::pair<std::wstring, std::wstring>>& getElements() const;
+    private:
+        /* Parsed (AI, value) pairs */
+        std::vector<std::pair<std::wstring, std::wstring>> elements;
+
+        /* Concatenated element strings, with the required group separators */
+        std::wstring data;
+
+        /*
+         * Pre-Conditions:
+         *      The first 2 digits of an AI.
+         *
+         * Post-Conditions:
+         *      Returns the number of digits of the AI,
+         *      or 0 if the prefix is unknown.
+         */
+        [[nodiscard]] static int getAiLength(int);
+
+        /*
+         * Pre-Conditions:
+         *      The first 2 digits of an AI.
+         *
+         * Post-Conditions:
+         *      Returns the predefined length of the element string (AI & value),
+         *      or 0 if it has a variable length.
+         *
+         * Based on the predefined length table of the GS1 General Specifications.
+         */
+        [[nodiscard]] static int getPredefinedLength(int);
+
+        /*
+         * Pre-Conditions:
+         *      A character c.
+         *
+         * Post-Conditions:
+         *      Returns true if the given character belongs to
+         *      the GS1 character set 82.
+         */
+        [[nodiscard]] static bool isCharacterSet82(wchar_t);
+
+        /*
+         * Pre-Conditions:
+         *      AI,
+         *      value of the AI.
+         *
+         * Post-Conditions:
+         *      Validates the element & appends it to the element list.
+         */
+        void addElement(const std::wstring&, const std::wstring&);
+
+        /*
+         * Pre-Conditions:
+         *      Element string in the bracketed form.
+         *
+         * Post-Conditions:
+         *      Parses the (AI)value pairs.
+         */
+        void parseBracketed(const std::wstring&);
+
+        /*
+         * Pre-Conditions:
+         *      Element string in the raw form.
+         *
+         * Post-Conditions:
+         *      Parses the concatenated element strings.
+         */
+        void parseRaw(const std::wstring&);
+
+        /*
+         * Pre-Conditions:
+         *      Mode,
+         *      character of the data.
+         *
+         * Post-Conditions:
+         *      Returns the cost of the character in the mode in sixths of a bit,
+         *      or -1 if the mode cannot encode it.
+         */
+        [[nodiscard]] static int getCost(Designator, wchar_t);
+    };
+}
+
+
+#endif //QR_IO_GS1_H
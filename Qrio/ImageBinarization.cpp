@@ -1,5 +1,5 @@
 #include <opencv2/opencv.hpp> // Philipp: Besser als das include #include <cv.h> (verursachte Fehlermeldungen)
-#include "../Header/ImageBinarization.hpp"
+#include "ImageBinarization.hpp"
 
 using namespace std;
 using namespace cv;
@@ -47,7 +47,7 @@ bool ImageBinarization::isLightingUneven() {
  * \brief Calculate global binarization.
  */
 void ImageBinarization::computeGlobalThreshold() {
-	threshold(blurredImage, binarizedImage, threshold_value, max_BINARY_value, CV_THRESH_OTSU);
+	threshold(blurredImage, binarizedImage, threshold_value, max_BINARY_value, THRESH_OTSU);
 }
 
 /**
@@ -0,0 +1,61 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_IMAGEFORMAT_H
+#define QR_IO_IMAGEFORMAT_H
+
+
+namespace Qrio {
+    /*
+     * Enumerates the image formats a QR code can be rendered to.
+     * PNG: Lossless, compressed, 1 bit per pixel (default),
+     * BMP: Uncompressed bitmap, 1 bit per pixel,
+     * PBM: Uncompressed binary portable bitmap (P4), black on white only,
+     * PPM: Uncompressed binary portable pixmap (P6),
+     * TIFF: Lossless tagged image file,
+     * JPEG: Lossy, blurs the module edges, only for previews,
+     * SVG: Scalable vector graphics, the scale is the module size in pixels,
+     * EPS: Encapsulated PostScript, the scale is the module size in points,
+     * PDF: Single page PDF, the scale is the module size in points,
+     * ESC_POS: ESC/POS raster bit image for receipt & label printers, the scale is in dots,
+     * ZPL: ZPL II label with a compressed graphic field, the scale is in dots,
+     * PCL: PCL raster graphic, the scale is in dots.
+     */
+    enum class ImageFormat {
+        PNG,
+        BMP,
+        PBM,
+        PPM,
+        TIFF,
+        JPEG,
+        SVG,
+        EPS,
+        PDF,
+        ESC_POS,
+        ZPL,
+        PCL,
+    };
+}
+
+
+#endif //QR_IO_IMAGEFORMAT_H
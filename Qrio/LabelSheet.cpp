@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BitmapWriter.h"
+#include "LabelSheet.h"
+#include "QrCode.h"
+
+
+namespace Qrio {
+    using std::string, std::wstring, std::vector, std::optional, std::function, std::future, std::async,
+            std::launch, std::max, std::min, std::memcpy, std::invalid_argument, std::domain_error,
+            std::ofstream, std::ios, std::thread, std::to_string;
+
+    /*
+     * Pre-Conditions:
+     *      Data strings of the QR codes (0x5C values must be doubled),
+     *      optional grid layout,
+     *      optional render options (scale, border, colors, & PNG compression),
+     *      optional ECL for all the QR codes.
+     *
+     * Post-Conditions:
+     *      Encodes & renders the QR codes onto the sheet.
+     *      Throws an invalid argument exception if the layout is invalid
+     *      or a QR code does not fit in its cell.
+     */
+    LabelSheet::LabelSheet(const vector<wstring>& data,
+                           const SheetLayout& layout,
+                           const RenderOptions& options,
+                           Ecl ecl) : options{options} {
+        if (layout.columns <= 0 or layout.cell_size < 0 or layout.spacing < 0 or layout.margin < 0
+            or options.scale <= 0 or options.border_width < 0) {
+            throw invalid_argument("Invalid sheet layout");
+        }
+
+        const size_t N{data.size()};
+        vector<optional<QrCode>> codes(N);
+
+        /* Encode in parallel, the cell size depends on the largest symbol */
+        forEach(N, layout.threads, [&](size_t i) {
+            codes[i].emplace(data[i], ecl);
+        });
+
+        int cell{layout.cell_size};
+
+        for (size_t i{0}; i < N and layout.cell_size == 0; i++) {
+            const int side{(static_cast<int>(codes[i]->getMatrix().size()) + 2 * options.border_width)
+                           * options.scale};
+
+            cell = max(cell, side);
+        }
+
+        const int columns{layout.columns};
+        const int rows{static_cast<int>((N + columns - 1) / columns)};
+
+        width = 2 * layout.margin + columns * cell + (columns - 1) * layout.spacing;
+        height = 2 * layout.margin + (rows == 0 ? 0 : rows * cell + (rows - 1) * layout.spacing);
+
+        const Color& light{options.light_color};
+        const Color& dark{options.dark_color};
+        const bool gray{light.red == light.green and light.green == light.blue
+                        and dark.red == dark.green and dark.green == dark.blue};
+
+        channels = gray ? 1 : 3;
+
+        const size_t stride{static_cast<size_t>(width) * channels};
+
+        pixels.resize(stride * height);
+
+        /* Light background, one row is filled by doubling copies of its first pixel */
+        vector<uint8_t> background(stride);
+
+        BitmapWriter::getPixel(light.toRgb(), channels, background.data());
+
+        for (size_t filled{channels}; filled < stride; filled *= 2) {
+            memcpy(background.data() + filled, background.data(), min(filled, stride - filled));
+        }
+
+        forEach(static_cast<size_t>(height), layout.threads, [&](size_t y) {
+            memcpy(pixels.data() + y * stride, background.data(), stride);
+        });
+
+        /* Every cell is a disjoint region of the sheet, so the workers never share pixels */
+        forEach(N, layout.threads, [&](size_t i) {
+            const QrCode& code{*codes[i]};
+            const int side{(static_cast<int>(code.getMatrix().size()) + 2 * options.border_width)
+                           * options.scale};
+
+            if (side > cell) {
+                throw invalid_argument("QR code " + to_string(i) + " does not fit in its cell");
+            }
+
+            const int x{layout.margin + static_cast<int>(i % columns) * (cell + layout.spacing) + (cell - side) / 2};
+            const int y{layout.margin + static_cast<int>(i / columns) * (cell + layout.spacing) + (cell - side) / 2};
+
+            code.renderInto(pixels.data() + y * stride + x * channels, stride, side, side, channels, options);
+        });
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the width of the sheet in pixels.
+     */
+    int LabelSheet::getWidth() const {
+        return width;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the height of the sheet in pixels.
+     */
+    int LabelSheet::getHeight() const {
+        return height;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of bytes per pixel (1 for gray, 3 for BGR).
+     */
+    size_t LabelSheet::getChannels() const {
+        return channels;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the pixels of the sheet, row by row without padding.
+     */
+    const vector<uint8_t>& LabelSheet::getPixels() const {
+        return pixels;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Optional image format (PNG or PPM).
+     *
+     * Post-Conditions:
+     *      Returns the encoded sheet.
+     *      Throws a domain error for the other formats.
+     */
+    vector<uint8_t> LabelSheet::render(ImageFormat format) const {
+        const size_t stride{static_cast<size_t>(width) * channels};
+
+        switch (format) {
+            case ImageFormat::PNG:
+                return BitmapWriter::toPng(pixels.data(), stride, width, height, channels,
+                                           options.png_compression, options.png_strategy);
+            case ImageFormat::PPM:
+                return BitmapWriter::toPpm(pixels.data(), stride, width, height, channels);
+            default:
+                throw domain_error("Label sheets are rendered as PNG or PPM");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      File name, the format is determined by its extension (.png or .ppm).
+     *
+     * Post-Conditions:
+     *      Saves the sheet under the given file name.
+     *      Throws an invalid argument exception for other extensions or if the file cannot be created,
+     *      & a domain error if it cannot be written.
+     */
+    void LabelSheet::save(const string& filename) const {
+        const ImageFormat format{QrCode::getFormat(filename)};
+
+        if (format != ImageFormat::PNG and format != ImageFormat::PPM) {
+            throw invalid_argument("Label sheets are saved as PNG or PPM");
+        }
+
+        const vector<uint8_t> bytes{render(format)};
+
+        ofstream file{filename, ios::binary};
+
+        if (not file) {
+            throw invalid_argument("Cannot create image file: " + filename);
+        }
+
+        file.write(reinterpret_cast<const char*>(bytes.data()),
+                   static_cast<std::streamsize>(bytes.size()));
+        file.close();
+
+        if (not file) {
+            throw domain_error("Image file could not be written: " + filename);
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Number of tasks,
+     *      number of worker threads (0 for the hardware concurrency),
+     *      task taking its index.
+     *
+     * Post-Conditions:
+     *      Runs the tasks on the worker threads, each worker takes every n-th index.
+     *      Rethrows the first exception of a worker.
+     */
+    void LabelSheet::forEach(size_t count, int threads, const function<void(size_t)>& task) {
+        const size_t workers{min(count, static_cast<size_t>(
+                threads > 0 ? threads : max(1u, thread::hardware_concurrency())))};
+
+        vector<future<void>> parts{};
+
+        for (size_t t{0}; t < workers; t++) {
+            parts.push_back(async(launch::async, [&, t]() {
+                for (size_t i{t}; i < count; i += workers) {
+                    task(i);
+                }
+            }));
+        }
+
+        for (future<void>& part: parts) {
+            part.get();
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_LABELSHEET_H
+#define QR_IO_LABELSHEET_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Ecl.h"
+#include "ImageFormat.h"
+#include "RenderOptions.h"
+#include "SheetLayout.h"
+
+
+namespace Qrio {
+    /*
+     * LabelSheet: 1.0
+     *
+     * Lays out many QR codes on a grid in one image (sticker sheets, print tiles).
+     * The symbols are encoded in parallel, then each worker renders its cells
+     * directly into their slice of the sheet, no intermediate images are made.
+     * The sheet is 8 bit gray when both colors are gray, otherwise BGR.
+     */
+    class LabelSheet final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Data strings of the QR codes (0x5C values must be doubled),
+         *      optional grid layout,
+         *      optional render options (scale, border, colors, & PNG compression),
+         *      optional ECL for all the QR codes.
+         *
+         * Post-Conditions:
+         *      Encodes & renders the QR codes onto the sheet.
+         *      Throws an invalid argument exception if the layout is invalid
+         *      or a QR code does not fit in its cell.
+         */
+        explicit LabelSheet(const std::vector<std::wstring>&,
+                            const SheetLayout& layout = SheetLayout{},
+                            const RenderOptions& options = RenderOptions{},
+                            Ecl ecl = Ecl::L);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the width of the sheet in pixels.
+         */
+        [[nodiscard]] int getWidth() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the height of the sheet in pixels.
+         */
+        [[nodiscard]] int getHeight() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of bytes per pixel (1 for gray, 3 for BGR).
+         */
+        [[nodiscard]] size_t getChannels() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the pixels of the sheet, row by row without padding.
+         */
+        [[nodiscard]] const std::vector<uint8_t>& getPixels() const;
+
+        /*
+         * Pre-Conditions:
+         *      Optional image format (PNG or PPM).
+         *
+         * Post-Conditions:
+         *      Returns the encoded sheet.
+         *      Throws a domain error for the other formats.
+         */
+        [[nodiscard]] std::vector<uint8_t> render(ImageFormat format = ImageFormat::PNG) const;
+
+        /*
+         * Pre-Conditions:
+         *      File name, the format is determined by its extension (.png or .ppm).
+         *
+         * Post-Conditions:
+         *      Saves the sheet under the given file name.
+         *      Throws an invalid argument exception for other extensions or if the file cannot be created,
+         *      & a domain error if it cannot be written.
+         */
+        void save(const std::string&) const;
+
+    private:
+        const RenderOptions options;
+
+        int width{0};
+
+        int height{0};
+
+        size_t channels{0};
+
+        std::vector<uint8_t> pixels{};
+
+        /*
+         * Pre-Conditions:
+         *      Number of tasks,
+         *      number of worker threads (0 for the hardware concurrency),
+         *      task taking its index.
+         *
+         * Post-Conditions:
+         *      Runs the tasks on the worker threads, each worker takes every n-th index.
+         *      Rethrows the first exception of a worker.
+         */
+        static void forEach(size_t, int, const std::function<void(size_t)>&);
+    };
+}
+
+
+#endif //QR_IO_LABELSHEET_H
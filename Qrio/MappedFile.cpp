@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+
+namespace Qrio {
+    using std::invalid_argument, std::string;
+
+    /*
+     * Pre-Conditions:
+     *      Path of the file.
+     *
+     * Post-Conditions:
+     *      Maps the file, an empty file has no mapping.
+     *      Throws an invalid argument exception if the file cannot be opened or mapped.
+     */
+    MappedFile::MappedFile(const string& path) {
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        LARGE_INTEGER file_size{};
+
+        if (file == INVALID_HANDLE_VALUE or not GetFileSizeEx(file, &file_size)) {
+            if (file != INVALID_HANDLE_VALUE) {
+                CloseHandle(file);
+            }
+
+            file = nullptr;
+            throw invalid_argument("Cannot open " + path);
+        }
+
+        length = static_cast<size_t>(file_size.QuadPart);
+
+        if (length == 0) {
+            return;
+        }
+
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        bytes = mapping ? static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+
+        if (bytes == nullptr) {
+            if (mapping != nullptr) {
+                CloseHandle(mapping);
+            }
+
+            CloseHandle(file);
+            throw invalid_argument("Cannot map " + path);
+        }
+#else
+        const int descriptor{open(path.c_str(), O_RDONLY)};
+        struct stat status{};
+
+        if (descriptor < 0 or fstat(descriptor, &status) != 0) {
+            if (descriptor >= 0) {
+                close(descriptor);
+            }
+
+            throw invalid_argument("Cannot open " + path);
+        }
+
+        length = static_cast<size_t>(status.st_size);
+
+        if (length != 0) {
+            void* address{mmap(nullptr, length, PROT_READ, MAP_SHARED, descriptor, 0)};
+
+            bytes = address == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(address);
+        }
+
+        /* The mapping stays valid after the descriptor is closed */
+        close(descriptor);
+
+        if (length != 0 and bytes == nullptr) {
+            throw invalid_argument("Cannot map " + path);
+        }
+#endif
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Unmaps the file.
+     */
+    MappedFile::~MappedFile() {
+#ifdef _WIN32
+        if (bytes != nullptr) {
+            UnmapViewOfFile(bytes);
+        }
+
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+
+        if (file != nullptr) {
+            CloseHandle(file);
+        }
+
+        bytes = nullptr;
+        mapping = nullptr;
+        file = nullptr;
+#else
+        if (bytes != nullptr) {
+            munmap(const_cast<uint8_t*>(bytes), length);
+        }
+#endif
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the first byte of the file (null for an empty file).
+     */
+    const uint8_t* MappedFile::data() const {
+        return bytes;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the size of the file in bytes.
+     */
+    size_t MappedFile::size() const {
+        return length;
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_MAPPEDFILE_H
+#define QR_IO_MAPPEDFILE_H
+
+#include <cstdint>
+#include <string>
+
+
+namespace Qrio {
+    /*
+     * MappedFile: 1.0
+     *
+     * Read only memory mapping of a whole file, unmapped on destruction.
+     * Pages are loaded on demand by the operating system,
+     * so large files are read without copying them into the process.
+     */
+    class MappedFile final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Path of the file.
+         *
+         * Post-Conditions:
+         *      Maps the file, an empty file has no mapping.
+         *      Throws an invalid argument exception if the file cannot be opened or mapped.
+         */
+        explicit MappedFile(const std::string&);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Unmaps the file.
+         */
+        ~MappedFile();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the first byte of the file (null for an empty file).
+         */
+        [[nodiscard]] const uint8_t* data() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the size of the file in bytes.
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        const uint8_t* bytes{nullptr};
+
+        size_t length{0};
+
+#ifdef _WIN32
+        /* File & mapping handles */
+        void* file{nullptr};
+
+        void* mapping{nullptr};
+#endif
+    };
+}
+
+
+#endif //QR_IO_MAPPEDFILE_H
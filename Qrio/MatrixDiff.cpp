@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "MatrixDiff.h"
+
+
+namespace Qrio {
+    using std::invalid_argument, std::pair, std::vector;
+
+    /*
+     * Pre-Conditions:
+     *      Previous matrix,
+     *      next matrix of the same size.
+     *
+     * Post-Conditions:
+     *      Returns the number of modules which differ.
+     *      Throws an invalid argument exception if the sizes differ.
+     */
+    size_t MatrixDiff::getChangedCount(const SquareMatrix& previous, const SquareMatrix& next) {
+        if (previous.size() != next.size()) {
+            throw invalid_argument("Matrices of different sizes");
+        }
+
+        size_t result{0};
+
+        for (size_t y{0}; y < next.size(); y++) {
+            for (size_t x{0}; x < next.size(); x++) {
+                if (previous.module(x, y) != next.module(x, y)) {
+                    result++;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Previous matrix,
+     *      next matrix of the same size,
+     *      optional number of unchanged modules bridged within a row (default 0).
+     *
+     * Post-Conditions:
+     *      Returns disjoint rectangles, in modules, covering all the changed modules,
+     *      top to bottom then left to right. Empty if the matrices are equal.
+     *      Throws an invalid argument exception if the sizes differ or the gap is negative.
+     *
+     * Changed modules are grouped into runs per row (bridging up to gap unchanged modules),
+     * then a run extends the rectangle above it when both span the same columns.
+     */
+    vector<DirtyRegion> MatrixDiff::getRegions(const SquareMatrix& previous, const SquareMatrix& next, int gap) {
+        if (previous.size() != next.size()) {
+            throw invalid_argument("Matrices of different sizes");
+        }
+
+        if (gap < 0) {
+            throw invalid_argument("Negative gap");
+        }
+
+        const int n{static_cast<int>(next.size())};
+
+        vector<DirtyRegion> result{};
+        vector<size_t> open{}, still_open{};
+        vector<pair<int, int>> runs{};
+
+        for (int y{0}; y < n; y++) {
+            runs.clear();
+
+            for (int x{0}; x < n; x++) {
+                if (previous.module(x, y) == next.module(x, y)) {
+                    continue;
+                }
+
+                if (not runs.empty() and x - runs.back().second <= gap) {
+                    runs.back().second = x + 1;
+                } else {
+                    runs.emplace_back(x, x + 1);
+                }
+            }
+
+            /* Both lists are sorted by column */
+            still_open.clear();
+            size_t above{0};
+
+            for (const auto& [start, end]: runs) {
+                while (above < open.size() and result[open[above]].x < start) {
+                    above++;
+                }
+
+                if (above < open.size() and result[open[above]].x == start
+                    and result[open[above]].width == end - start) {
+                    result[open[above]].height++;
+                    still_open.push_back(open[above]);
+                } else {
+                    result.push_back(DirtyRegion{start, y, end - start, 1});
+                    still_open.push_back(result.size() - 1);
+                }
+            }
+
+            open.swap(still_open);
+        }
+
+        return result;
+    }
+}
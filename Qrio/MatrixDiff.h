@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_MATRIXDIFF_H
+#define QR_IO_MATRIXDIFF_H
+
+#include <vector>
+
+#include "DirtyRegion.h"
+#include "SquareMatrix.h"
+
+
+namespace Qrio {
+    /*
+     * MatrixDiff: 1.0
+     *
+     * Differences between two module matrices of the same size, for partial refreshes
+     * of e-paper & LED matrix displays which only redraw the changed rectangles.
+     */
+    class MatrixDiff final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Previous matrix,
+         *      next matrix of the same size.
+         *
+         * Post-Conditions:
+         *      Returns the number of modules which differ.
+         *      Throws an invalid argument exception if the sizes differ.
+         */
+        [[nodiscard]] static size_t getChangedCount(const SquareMatrix&, const SquareMatrix&);
+
+        /*
+         * Pre-Conditions:
+         *      Previous matrix,
+         *      next matrix of the same size,
+         *      optional number of unchanged modules bridged within a row (default 0).
+         *
+         * Post-Conditions:
+         *      Returns disjoint rectangles, in modules, covering all the changed modules,
+         *      top to bottom then left to right. Empty if the matrices are equal.
+         *      Throws an invalid argument exception if the sizes differ or the gap is negative.
+         */
+        [[nodiscard]] static std::vector<DirtyRegion> getRegions(const SquareMatrix&, const SquareMatrix&,
+                                                                 int gap = 0);
+    };
+}
+
+
+#endif //QR_IO_MATRIXDIFF_H
@@ -0,0 +1,235 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+#include "BitmapWriter.h"
+#include "OpenCvAdapter.h"
+
+
+namespace Qrio {
+    using std::domain_error, std::invalid_argument, std::ios, std::memcpy, std::ofstream, std::string, std::vector;
+    using cv::imencode, cv::saturate_cast, cv::Mat, cv::Rect, cv::Scalar, cv::VideoWriter, cv::IMWRITE_JPEG_QUALITY;
+
+    /*
+     * Pre-Conditions:
+     *      QR code,
+     *      optional render options (scale, border, & colors).
+     *
+     * Post-Conditions:
+     *      Returns the 3 channel BGR image of the QR code.
+     *      Throws an invalid argument exception for invalid options (Check QrCode::checkOptions).
+     */
+    Mat OpenCvAdapter::toMat(const QrCode& code, const RenderOptions& options) {
+        QrCode::checkOptions(options);
+
+        const SquareMatrix& matrix{code.getMatrix()};
+        const int S{static_cast<int>(matrix.size())};
+        const int scale{options.scale}, border_width{options.border_width};
+
+        /* Calculate the side of the output image (including the border on all four sides) */
+        const int N{(S + 2 * border_width) * scale};
+
+        /* Create an image to store the matrix data with border, the border is already light */
+        Mat image(N, N, CV_8UC3, toScalar(options.light_color));
+
+        const uint8_t dark[3]{options.dark_color.blue, options.dark_color.green, options.dark_color.red};
+
+        /* Paint one scanline per module row, then replicate it over the module height */
+        for (int i{0}; i < S and (i + border_width) * scale < N; i++) {
+            const int y{(i + border_width) * scale};
+            uint8_t* line{image.ptr<uint8_t>(y)};
+
+            BitmapWriter::paintRow(matrix, i, scale, border_width, line, dark, sizeof(dark));
+
+            for (int k{1}; k < scale and y + k < N; k++) {
+                memcpy(image.ptr<uint8_t>(y + k), line, static_cast<size_t>(N) * sizeof(dark));
+            }
+        }
+
+        return image;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      QR code,
+     *      destination 8 bit gray, BGR, or BGRA image,
+     *      region of the destination to draw in,
+     *      optional render options (scale, border, & colors).
+     *
+     * Post-Conditions:
+     *      Draws the QR code at the top left of the region, in the pixel format of the destination,
+     *      without a temporary image. Pixels of the region outside of the QR code are left untouched.
+     *      Throws an invalid argument exception if the destination is unsupported,
+     *      the region is outside the destination, or the QR code does not fit in the region.
+     */
+    void OpenCvAdapter::renderInto(const QrCode& code, Mat& destination, const Rect& region,
+                                   const RenderOptions& options) {
+        if (destination.depth() != CV_8U) {
+            throw invalid_argument("Only 8 bit images are supported");
+        }
+
+        if (region.x < 0 or region.y < 0 or region.width < 0 or region.height < 0
+            or region.x + region.width > destination.cols or region.y + region.height > destination.rows) {
+            throw invalid_argument("Region is outside of the image");
+        }
+
+        const size_t channels{static_cast<size_t>(destination.channels())};
+
+        code.renderInto(destination.ptr<uint8_t>(region.y) + region.x * channels, destination.step,
+                        region.width, region.height, channels, options);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      QR code,
+     *      image format,
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Returns the encoded image bytes.
+     *      Throws a domain error if OpenCV cannot encode the format.
+     */
+    vector<uint8_t> OpenCvAdapter::render(const QrCode& code, ImageFormat format,
+                                          const RenderOptions& options) {
+        vector<uint8_t> result{};
+        vector<int> params{};
+        string extension;
+
+        switch (format) {
+            case ImageFormat::JPEG:
+                extension = ".jpg";
+                params.insert(params.end(), {IMWRITE_JPEG_QUALITY, options.jpeg_quality});
+                break;
+            default:
+                return code.render(format, options);
+        }
+
+        if (not imencode(extension, toMat(code, options), result, params)) {
+            throw domain_error("Image encoder unavailable for " + extension);
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      QR code,
+     *      file name, the format is determined by its extension,
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Saves the QR code as an image under the given file name.
+     *      Throws an invalid argument exception for unknown extensions
+     *      or if the file cannot be created, & a domain error if it cannot be written.
+     */
+    void OpenCvAdapter::save(const QrCode& code, const string& filename, const RenderOptions& options) {
+        const ImageFormat format{QrCode::getFormat(filename)};
+
+        ofstream file{filename, ios::binary};
+
+        if (not file) {
+            throw invalid_argument("Cannot create image file: " + filename);
+        }
+
+        /* The built-in formats are streamed */
+        if (format != ImageFormat::JPEG) {
+            code.render(file, format, options);
+        } else {
+            const vector<uint8_t> bytes{render(code, format, options)};
+
+            file.write(reinterpret_cast<const char*>(bytes.data()),
+                       static_cast<std::streamsize>(bytes.size()));
+        }
+
+        file.close();
+
+        if (not file) {
+            throw domain_error("Image file could not be written: " + filename);
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Frame stream,
+     *      file name of the video (an AVI container is recommended),
+     *      optional frame rate (default 10 frames per second),
+     *      optional render options (scale, border, & colors).
+     *
+     * Post-Conditions:
+     *      Encodes the frames in parallel & writes them as a Motion JPEG video,
+     *      all the frames share one version, hence one image size.
+     *      Returns the statistics of the run.
+     *      Throws a domain error if the video cannot be opened.
+     */
+    FrameStream::Stats OpenCvAdapter::saveVideo(const FrameStream& stream, const string& filename, double fps,
+                                                const RenderOptions& options) {
+        VideoWriter writer{};
+
+        const FrameStream::Stats result{stream.encode([&](size_t, const QrCode& frame) {
+            const Mat image{toMat(frame, options)};
+
+            if (not writer.isOpened()
+                and not writer.open(filename, VideoWriter::fourcc('M', 'J', 'P', 'G'), fps, image.size())) {
+                throw domain_error("Cannot open the video " + filename);
+            }
+
+            writer.write(image);
+        })};
+
+        writer.release();
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Color.
+     *
+     * Post-Conditions:
+     *      Returns the equivalent BGR cv::Scalar.
+     */
+    Scalar OpenCvAdapter::toScalar(const Color& color) {
+        return {static_cast<double>(color.blue), static_cast<double>(color.green),
+                static_cast<double>(color.red)};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      BGR cv::Scalar.
+     *
+     * Post-Conditions:
+     *      Returns the equivalent color, channels are saturated to [0, 255].
+     */
+    Color OpenCvAdapter::toColor(const Scalar& color) {
+        return {saturate_cast<uint8_t>(color[0]), saturate_cast<uint8_t>(color[1]),
+                saturate_cast<uint8_t>(color[2])};
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_OPENCVADAPTER_H
+#define QR_IO_OPENCVADAPTER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+#include "Color.h"
+#include "FrameStream.h"
+#include "ImageFormat.h"
+#include "QrCode.h"
+#include "RenderOptions.h"
+
+
+namespace Qrio {
+    /*
+     * OpenCvAdapter: 1.0
+     *
+     * Optional bridge between QR codes & OpenCV, part of the qrio_opencv target.
+     * Provides cv::Mat images & the format the built-in writers lack (JPEG),
+     * the other formats are delegated to QrCode::render.
+     */
+    class OpenCvAdapter final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      QR code,
+         *      optional render options (scale, border, & colors).
+         *
+         * Post-Conditions:
+         *      Returns the 3 channel BGR image of the QR code.
+         *      Throws an invalid argument exception for invalid options (Check QrCode::checkOptions).
+         */
+        [[nodiscard]] static cv::Mat toMat(const QrCode&, const RenderOptions& options = RenderOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      QR code,
+         *      destination 8 bit gray, BGR, or BGRA image,
+         *      region of the destination to draw in,
+         *      optional render options (scale, border, & colors).
+         *
+         * Post-Conditions:
+         *      Draws the QR code at the top left of the region, in the pixel format of the destination,
+         *      without a temporary image. Pixels of the region outside of the QR code are left untouched.
+         *      Throws an invalid argument exception if the destination is unsupported,
+         *      the region is outside the destination, or the QR code does not fit in the region.
+         */
+        static void renderInto(const QrCode&, cv::Mat&, const cv::Rect&,
+                               const RenderOptions& options = RenderOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      QR code,
+         *      image format,
+         *      optional render options.
+         *
+         * Post-Conditions:
+         *      Returns the encoded image bytes.
+         *      Throws a domain error if OpenCV cannot encode the format.
+         */
+        [[nodiscard]] static std::vector<uint8_t> render(const QrCode&,
+                                                         ImageFormat,
+                                                         const RenderOptions& options = RenderOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      QR code,
+         *      file name, the format is determined by its extension,
+         *      optional render options.
+         *
+         * Post-Conditions:
+         *      Saves the QR code as an image under the given file name.
+         *      Throws an invalid argument exception for unknown extensions
+         *      or if the file cannot be created, & a domain error if it cannot be written.
+         */
+        static void save(const QrCode&, const std::string&, const RenderOptions& options = RenderOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      Frame stream,
+         *      file name of the video (an AVI container is recommended),
+         *      optional frame rate (default 10 frames per second),
+         *      optional render options (scale, border, & colors).
+         *
+         * Post-Conditions:
+         *      Encodes the frames in parallel & writes them as a Motion JPEG video.
+         *      Returns the statistics of the run.
+         *      Throws a domain error if the video cannot be opened.
+         */
+        static FrameStream::Stats saveVideo(const FrameStream&,
+                                            const std::string&,
+                                            double fps = 10,
+                                            const RenderOptions& options = RenderOptions{});
+
+        /*
+         * Pre-Conditions:
+         *      Color.
+         *
+         * Post-Conditions:
+         *      Returns the equivalent BGR cv::Scalar.
+         */
+        [[nodiscard]] static cv::Scalar toScalar(const Color&);
+
+        /*
+         * Pre-Conditions:
+         *      BGR cv::Scalar.
+         *
+         * Post-Conditions:
+         *      Returns the equivalent color, channels are saturated to [0, 255].
+         */
+        [[nodiscard]] static Color toColor(const cv::Scalar&);
+    };
+}
+
+
+#endif //QR_IO_OPENCVADAPTER_H
@@ -0,0 +1,198 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "PackReader.h"
+#include "PackWriter.h"
+
+
+namespace Qrio {
+    using std::string, std::string_view, std::invalid_argument, std::memcmp;
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns true if the entry was found.
+     */
+    PackReader::Entry::operator bool() const {
+        return record != nullptr;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry was found.
+     *
+     * Post-Conditions:
+     *      Returns the decoded symbol record.
+     */
+    SymbolRecord PackReader::Entry::getRecord() const {
+        return SymbolRecord{record, record_size};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Path of the pack file.
+     *
+     * Post-Conditions:
+     *      Maps the pack file & checks its footer & index bounds.
+     *      Throws an invalid argument exception if the file cannot be read or is not a pack file.
+     *
+     * Only the header, the footer & the index bounds are checked, so opening does not touch
+     * the pages of the entries. Entry bounds are checked when the entry is read.
+     */
+    PackReader::PackReader(const string& path) : file{path} {
+        const uint8_t* bytes{file.data()};
+        const size_t size{file.size()};
+
+        if (size < PackWriter::HEADER_SIZE + PackWriter::FOOTER_SIZE
+            or memcmp(bytes, "QRPK", 4) != 0 or memcmp(bytes + size - 4, "QRPK", 4) != 0
+            or getInteger(bytes + 4, 4) != PackWriter::REVISION) {
+            throw invalid_argument("Not a pack file: " + path);
+        }
+
+        const uint8_t* footer{bytes + size - PackWriter::FOOTER_SIZE};
+        const uint64_t entries_offset{getInteger(footer, 8)};
+        const uint64_t count{getInteger(footer + 8, 8)};
+        const uint64_t slots_offset{getInteger(footer + 16, 8)};
+        const uint64_t slots{getInteger(footer + 24, 4)};
+        const uint64_t end{size - PackWriter::FOOTER_SIZE};
+
+        if (entries_offset < PackWriter::HEADER_SIZE or entries_offset > end
+            or count > (end - entries_offset) / PackWriter::ENTRY_SIZE
+            or slots_offset != entries_offset + count * PackWriter::ENTRY_SIZE
+            or slots == 0 or (slots & (slots - 1)) != 0 or slots <= count
+            or slots_offset + slots * 4 != end) {
+            throw invalid_argument("Corrupted pack index: " + path);
+        }
+
+        entries = bytes + entries_offset;
+        entry_count = count;
+        this->slots = bytes + slots_offset;
+        slot_count = slots;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key.
+     *
+     * Post-Conditions:
+     *      Returns the entry of the key, an empty entry if the key is missing.
+     *
+     * The 64 bit hash stored in the entry table is compared before the key bytes,
+     * so a probe normally touches one slot, one entry & one key.
+     */
+    PackReader::Entry PackReader::find(string_view key) const {
+        const uint64_t hash{PackWriter::getHash(key)};
+        size_t slot{hash & (slot_count - 1)};
+
+        for (size_t probes{0}; probes < slot_count; probes++) {
+            const uint64_t number{getInteger(slots + 4 * slot, 4)};
+
+            if (number == 0) {
+                break;
+            }
+
+            if (number <= entry_count
+                and getInteger(entries + (number - 1) * PackWriter::ENTRY_SIZE, 8) == hash) {
+                Entry result{getEntry(number - 1)};
+
+                if (result.key == key) {
+                    return result;
+                }
+            }
+
+            slot = (slot + 1) & (slot_count - 1);
+        }
+
+        return Entry{};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry number in [0, size[.
+     *
+     * Post-Conditions:
+     *      Returns the entry, in insertion order (including replaced entries).
+     *      Throws an invalid argument exception if the entry is outside of the data section.
+     */
+    PackReader::Entry PackReader::getEntry(size_t index) const {
+        const uint8_t* entry{entries + index * PackWriter::ENTRY_SIZE};
+        const uint64_t offset{getInteger(entry + 8, 8)};
+        const uint64_t key_size{getInteger(entry + 16, 4)};
+        const uint64_t record_size{getInteger(entry + 20, 4)};
+        const uint64_t image_size{getInteger(entry + 24, 4)};
+        const uint64_t limit{static_cast<uint64_t>(entries - file.data())};
+
+        if (offset < PackWriter::HEADER_SIZE or offset > limit
+            or key_size + record_size + image_size > limit - offset) {
+            throw invalid_argument("Corrupted pack entry");
+        }
+
+        const uint8_t* key{file.data() + offset};
+
+        Entry result{};
+
+        result.key = string_view{reinterpret_cast<const char*>(key), key_size};
+        result.record = key + key_size;
+        result.record_size = record_size;
+        result.image = image_size > 0 ? result.record + record_size : nullptr;
+        result.image_size = image_size;
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of entries.
+     */
+    size_t PackReader::size() const {
+        return entry_count;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Pointer to the bytes,
+     *      number of bytes (4 or 8).
+     *
+     * Post-Conditions:
+     *      Returns the little endian value.
+     */
+    uint64_t PackReader::getInteger(const uint8_t* bytes, size_t size) {
+        uint64_t result{0};
+
+        for (size_t i{0}; i < size; i++) {
+            result |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        }
+
+        return result;
+    }
+}
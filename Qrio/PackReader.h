@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_PACKREADER_H
+#define QR_IO_PACKREADER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "MappedFile.h"
+#include "SymbolRecord.h"
+
+
+namespace Qrio {
+    /*
+     * PackReader: 1.0
+     *
+     * Memory mapped reader of the pack files written by PackWriter.
+     * A lookup hashes the key & probes the mapped hash table, O(1) on average,
+     * & returns views into the mapping: no copy, & no system call once the pages are resident.
+     * The reader is immutable, so any number of threads can share it.
+     */
+    class PackReader final {
+    public:
+        /*
+         * Zero copy view of an entry, valid as long as the reader.
+         */
+        class Entry final {
+        public:
+            /* Key bytes */
+            std::string_view key{};
+
+            /* Symbol record bytes, null if the key is missing */
+            const uint8_t* record{nullptr};
+
+            size_t record_size{0};
+
+            /* Rendered image bytes, null if none were stored */
+            const uint8_t* image{nullptr};
+
+            size_t image_size{0};
+
+            /*
+             * Pre-Conditions:
+             *      None.
+             *
+             * Post-Conditions:
+             *      Returns true if the entry was found.
+             */
+            explicit operator bool() const;
+
+            /*
+             * Pre-Conditions:
+             *      Entry was found.
+             *
+             * Post-Conditions:
+             *      Returns the decoded symbol record.
+             */
+            [[nodiscard]] SymbolRecord getRecord() const;
+        };
+
+        /*
+         * Pre-Conditions:
+         *      Path of the pack file.
+         *
+         * Post-Conditions:
+         *      Maps the pack file & checks its footer & index bounds.
+         *      Throws an invalid argument exception if the file cannot be read or is not a pack file.
+         */
+        explicit PackReader(const std::string&);
+
+        /*
+         * Pre-Conditions:
+         *      Key.
+         *
+         * Post-Conditions:
+         *      Returns the entry of the key, an empty entry if the key is missing.
+         */
+        [[nodiscard]] Entry find(std::string_view) const;
+
+        /*
+         * Pre-Conditions:
+         *      Entry number in [0, size[.
+         *
+         * Post-Conditions:
+         *      Returns the entry, in insertion order (including replaced entries).
+         *      Throws an invalid argument exception if the entry is outside of the data section.
+         */
+        [[nodiscard]] Entry getEntry(size_t) const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of entries.
+         */
+        [[nodiscard]] size_t size() const;
+
+    private:
+        MappedFile file;
+
+        const uint8_t* entries{nullptr};
+
+        size_t entry_count{0};
+
+        const uint8_t* slots{nullptr};
+
+        size_t slot_count{0};
+
+        /*
+         * Pre-Conditions:
+         *      Pointer to the bytes,
+         *      number of bytes (4 or 8).
+         *
+         * Post-Conditions:
+         *      Returns the little endian value.
+         */
+        [[nodiscard]] static uint64_t getInteger(const uint8_t*, size_t);
+    };
+}
+
+
+#endif //QR_IO_PACKREADER_H
@@ -0,0 +1,446 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "MappedFile.h"
+#include "PackWriter.h"
+#include "SymbolRecord.h"
+
+
+namespace Qrio {
+    using std::string, std::string_view, std::wstring, std::vector, std::pair, std::function,
+            std::future, std::async, std::launch, std::thread, std::min, std::max, std::memcmp,
+            std::ios, std::streamsize, std::streamoff, std::invalid_argument, std::domain_error, std::length_error;
+    using std::filesystem::exists, std::filesystem::file_size, std::filesystem::resize_file;
+
+    /*
+     * Pre-Conditions:
+     *      Path of the pack file,
+     *      optional matrix encoding of the records (default the smaller one),
+     *      optional append mode (default false).
+     *
+     * Post-Conditions:
+     *      Creates the pack file, replacing any existing one,
+     *      or in append mode reopens it & keeps its entries. The index of a closed pack
+     *      is dropped until the next close, an unclosed pack is cut after its last whole entry.
+     *      Throws an invalid argument exception if the file cannot be created
+     *      or an existing file is not a pack file, & a length error if it is too large to append to.
+     */
+    PackWriter::PackWriter(const string& path, MatrixEncoding encoding, bool append) : encoding{encoding} {
+        if (append and exists(path) and file_size(path) >= HEADER_SIZE) {
+            offset = recover(path);
+            resize_file(path, offset);
+            file.open(path, ios::binary | ios::in | ios::out);
+            file.seekp(static_cast<streamoff>(offset));
+        } else {
+            file.open(path, ios::binary | ios::trunc);
+
+            string header{"QRPK"};
+
+            putInteger(REVISION, 4, header);
+            file.write(header.data(), static_cast<streamsize>(header.size()));
+        }
+
+        if (not file) {
+            throw invalid_argument("Cannot create pack file: " + path);
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Closes the pack file if close was not called, errors are ignored.
+     */
+    PackWriter::~PackWriter() {
+        try {
+            close();
+        } catch (const domain_error&) {
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key of the entry,
+     *      QR code,
+     *      optional rendered image bytes.
+     *
+     * Post-Conditions:
+     *      Appends the entry, a later entry with the same key replaces the earlier one.
+     *      Throws a domain error exception if the pack is closed,
+     *      & a length error if the key or an entry part exceeds 4 GiB, or the pack is full (Check MAX_ENTRIES).
+     */
+    void PackWriter::add(string_view key, const QrCode& code, const vector<uint8_t>& image) {
+        append(key, SymbolRecord{code}.toBytes(encoding), image);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Keys & data strings of the QR codes,
+     *      ECL of all the QR codes,
+     *      optional number of worker threads (0 for the hardware concurrency).
+     *
+     * Post-Conditions:
+     *      Encodes the QR codes in parallel & appends them in order, without images.
+     */
+    void PackWriter::addAll(const vector<pair<string, wstring>>& items, Ecl ecl, int threads) {
+        addAll(items, ecl, function<vector<uint8_t>(const QrCode&)>{}, threads);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Keys & data strings of the QR codes,
+     *      ECL of all the QR codes,
+     *      image format (not JPEG),
+     *      render options,
+     *      optional number of worker threads (0 for the hardware concurrency).
+     *
+     * Post-Conditions:
+     *      Encodes & renders the QR codes in parallel & appends them in order.
+     */
+    void PackWriter::addAll(const vector<pair<string, wstring>>& items, Ecl ecl, ImageFormat format,
+                            const RenderOptions& options, int threads) {
+        addAll(items, ecl, [format, &options](const QrCode& code) {
+            return code.render(format, options);
+        }, threads);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of entries added.
+     */
+    size_t PackWriter::size() const {
+        return entries.size();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Pushes the entries added so far to the file, so they survive a crash
+     *      & can be recovered in append mode.
+     *      Throws a domain error exception if the file could not be written.
+     */
+    void PackWriter::flush() {
+        file.flush();
+
+        if (not file) {
+            throw domain_error("Pack file could not be written");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Writes the index & the footer, then closes the file. Does nothing if already closed.
+     *      Throws a domain error exception if the file could not be written.
+     *
+     * The hash table has at least twice as many slots as entries, so probe sequences stay short.
+     */
+    void PackWriter::close() {
+        if (closed) {
+            return;
+        }
+
+        closed = true;
+
+        /* The smallest power of 2 from twice the entries, so at most 2^31 slots */
+        static_assert(2 * MAX_ENTRIES <= 0xFFFFFFFF);
+
+        size_t slot_count{2};
+
+        while (slot_count < 2 * entries.size()) {
+            slot_count *= 2;
+        }
+
+        vector<uint32_t> slots(slot_count, 0);
+
+        for (size_t i{0}; i < entries.size(); i++) {
+            const Entry& entry{entries[i]};
+            const string_view key{keys.data() + entry.key_position, entry.key_size};
+            size_t slot{entry.hash & (slot_count - 1)};
+
+            while (slots[slot] != 0) {
+                const Entry& other{entries[slots[slot] - 1]};
+
+                if (other.hash == entry.hash
+                    and string_view{keys.data() + other.key_position, other.key_size} == key) {
+                    break;
+                }
+
+                slot = (slot + 1) & (slot_count - 1);
+            }
+
+            slots[slot] = static_cast<uint32_t>(i + 1);
+        }
+
+        const uint64_t entries_offset{offset};
+        const uint64_t slots_offset{entries_offset + entries.size() * ENTRY_SIZE};
+        string buffer{};
+
+        const auto flush{[&](size_t limit) {
+            if (buffer.size() >= limit) {
+                file.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }};
+
+        for (const Entry& entry: entries) {
+            putInteger(entry.hash, 8, buffer);
+            putInteger(entry.offset, 8, buffer);
+            putInteger(entry.key_size, 4, buffer);
+            putInteger(entry.record_size, 4, buffer);
+            putInteger(entry.image_size, 4, buffer);
+            putInteger(0, 4, buffer);
+            flush(1 << 20);
+        }
+
+        for (uint32_t slot: slots) {
+            putInteger(slot, 4, buffer);
+            flush(1 << 20);
+        }
+
+        putInteger(entries_offset, 8, buffer);
+        putInteger(entries.size(), 8, buffer);
+        putInteger(slots_offset, 8, buffer);
+        putInteger(slot_count, 4, buffer);
+        buffer += "QRPK";
+        flush(0);
+
+        file.close();
+        entries = vector<Entry>{};
+        keys = string{};
+
+        if (not file) {
+            throw domain_error("Pack file could not be written");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key bytes.
+     *
+     * Post-Conditions:
+     *      Returns the 64 bit FNV-1a hash of the key.
+     */
+    uint64_t PackWriter::getHash(string_view key) {
+        uint64_t result{0xCBF29CE484222325};
+
+        for (char c: key) {
+            result = (result ^ static_cast<uint8_t>(c)) * 0x100000001B3;
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Path of an existing pack file.
+     *
+     * Post-Conditions:
+     *      Loads the entries of the data section & returns the offset following the last whole one.
+     *      Throws an invalid argument exception if the file is not a pack file,
+     *      & a length error if it holds more than MAX_ENTRIES entries.
+     *
+     * The data section of a closed pack ends at its entry table, the footer is only trusted
+     * if the index fills the rest of the file exactly. Otherwise the whole file is scanned.
+     */
+    uint64_t PackWriter::recover(const string& path) {
+        const MappedFile mapping{path};
+        const uint8_t* bytes{mapping.data()};
+        const uint64_t size{mapping.size()};
+
+        const auto getInteger{[bytes](uint64_t position, size_t length) {
+            uint64_t result{0};
+
+            for (size_t i{0}; i < length; i++) {
+                result |= static_cast<uint64_t>(bytes[position + i]) << (8 * i);
+            }
+
+            return result;
+        }};
+
+        if (memcmp(bytes, "QRPK", 4) != 0 or getInteger(4, 4) != REVISION) {
+            throw invalid_argument("Not a pack file: " + path);
+        }
+
+        uint64_t end{size};
+
+        if (size >= HEADER_SIZE + FOOTER_SIZE and memcmp(bytes + size - 4, "QRPK", 4) == 0) {
+            const uint64_t footer{size - FOOTER_SIZE};
+            const uint64_t entries_offset{getInteger(footer, 8)};
+            const uint64_t count{getInteger(footer + 8, 8)};
+            const uint64_t slots_offset{getInteger(footer + 16, 8)};
+            const uint64_t slot_count{getInteger(footer + 24, 4)};
+
+            if (entries_offset >= HEADER_SIZE and entries_offset <= footer
+                and count <= (footer - entries_offset) / ENTRY_SIZE
+                and slots_offset == entries_offset + count * ENTRY_SIZE
+                and slot_count <= (footer - slots_offset) / 4 and slots_offset + slot_count * 4 == footer) {
+                end = entries_offset;
+            }
+        }
+
+        uint64_t position{HEADER_SIZE};
+
+        while (end - position >= PREFIX_SIZE) {
+            const uint64_t key_size{getInteger(position, 4)};
+            const uint64_t record_size{getInteger(position + 4, 4)};
+            const uint64_t image_size{getInteger(position + 8, 4)};
+
+            if (key_size + record_size + image_size > end - position - PREFIX_SIZE) {
+                break;
+            }
+
+            if (entries.size() == MAX_ENTRIES) {
+                throw length_error("Pack files are limited to 2^30 entries");
+            }
+
+            const string_view key{reinterpret_cast<const char*>(bytes + position + PREFIX_SIZE), key_size};
+
+            entries.push_back(Entry{getHash(key), position + PREFIX_SIZE, keys.size(),
+                                    static_cast<uint32_t>(key_size), static_cast<uint32_t>(record_size),
+                                    static_cast<uint32_t>(image_size)});
+            keys += key;
+            position += PREFIX_SIZE + key_size + record_size + image_size;
+        }
+
+        return position;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key of the entry,
+     *      record bytes,
+     *      image bytes.
+     *
+     * Post-Conditions:
+     *      Appends the entry.
+     *      Throws a domain error exception if the pack is closed,
+     *      & a length error if a part exceeds 4 GiB or the pack is full.
+     */
+    void PackWriter::append(string_view key, const vector<uint8_t>& record, const vector<uint8_t>& image) {
+        if (closed) {
+            throw domain_error("Pack file is closed");
+        }
+
+        if (key.size() > 0xFFFFFFFF or record.size() > 0xFFFFFFFF or image.size() > 0xFFFFFFFF) {
+            throw length_error("Pack entries are limited to 4 GiB per part");
+        }
+
+        if (entries.size() >= MAX_ENTRIES) {
+            throw length_error("Pack files are limited to 2^30 entries");
+        }
+
+        string prefix{};
+
+        putInteger(key.size(), 4, prefix);
+        putInteger(record.size(), 4, prefix);
+        putInteger(image.size(), 4, prefix);
+
+        entries.push_back(Entry{getHash(key), offset + PREFIX_SIZE, keys.size(), static_cast<uint32_t>(key.size()),
+                                static_cast<uint32_t>(record.size()), static_cast<uint32_t>(image.size())});
+        keys += key;
+
+        file.write(prefix.data(), static_cast<streamsize>(prefix.size()));
+        file.write(key.data(), static_cast<streamsize>(key.size()));
+        file.write(reinterpret_cast<const char*>(record.data()), static_cast<streamsize>(record.size()));
+        file.write(reinterpret_cast<const char*>(image.data()), static_cast<streamsize>(image.size()));
+        offset += PREFIX_SIZE + key.size() + record.size() + image.size();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Keys & data strings of the QR codes,
+     *      ECL of all the QR codes,
+     *      renderer of the image bytes (empty function for none),
+     *      number of worker threads (0 for the hardware concurrency).
+     *
+     * Post-Conditions:
+     *      Encodes the QR codes in parallel blocks & appends them in order.
+     *
+     * Only one block of records is held in memory, whatever the number of QR codes.
+     */
+    void PackWriter::addAll(const vector<pair<string, wstring>>& items, Ecl ecl,
+                            const function<vector<uint8_t>(const QrCode&)>& renderer, int threads) {
+        const size_t BLOCK{4096};
+        const size_t workers{static_cast<size_t>(threads > 0 ? threads : max(1u, thread::hardware_concurrency()))};
+
+        vector<vector<uint8_t>> records(BLOCK), images(BLOCK);
+
+        for (size_t start{0}; start < items.size(); start += BLOCK) {
+            const size_t count{min(BLOCK, items.size() - start)};
+            vector<future<void>> parts{};
+
+            for (size_t t{0}; t < min(workers, count); t++) {
+                parts.push_back(async(launch::async, [&, t]() {
+                    for (size_t i{t}; i < count; i += workers) {
+                        const QrCode code{items[start + i].second, ecl};
+
+                        records[i] = SymbolRecord{code}.toBytes(encoding);
+                        images[i] = renderer ? renderer(code) : vector<uint8_t>{};
+                    }
+                }));
+            }
+
+            for (future<void>& part: parts) {
+                part.get();
+            }
+
+            for (size_t i{0}; i < count; i++) {
+                append(items[start + i].first, records[i], images[i]);
+            }
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Value,
+     *      number of bytes (4 or 8),
+     *      output buffer.
+     *
+     * Post-Conditions:
+     *      Appends the value in little endian order.
+     */
+    void PackWriter::putInteger(uint64_t value, size_t size, string& buffer) {
+        for (size_t i{0}; i < size; i++) {
+            buffer += static_cast<char>(value >> (8 * i) & 0xFF);
+        }
+    }
+}
@@ -0,0 +1,271 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_PACKWRITER_H
+#define QR_IO_PACKWRITER_H
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Ecl.h"
+#include "ImageFormat.h"
+#include "MatrixEncoding.h"
+#include "QrCode.h"
+#include "RenderOptions.h"
+
+
+namespace Qrio {
+    /*
+     * PackWriter: 1.0
+     *
+     * Stores many pre-generated symbols in one pack file, read back by PackReader.
+     * Each entry holds a key, the symbol record (packed or run length matrix)
+     * & optionally the rendered image bytes. Entries are appended as they come,
+     * the index is written once by close. The entries carry their own sizes,
+     * so a pack can be reopened to append more, even if it was never closed.
+     *
+     * Binary layout (little endian): "QRPK", revision (4 bytes),
+     * then each entry as key size, record size, image size (4 bytes each),
+     * key bytes, record bytes & image bytes,
+     * then the entry table (ENTRY_SIZE bytes per entry: FNV-1a hash of the key (8),
+     * offset of the key (8), key size, record size, image size (4 each), padding (4)),
+     * then the hash table (4 bytes per slot: entry number + 1, 0 if empty, linear probing),
+     * then the footer: entry table offset, entry count, hash table offset (8 each),
+     * slot count (4), "QRPK".
+     */
+    class PackWriter final {
+    public:
+        /* Size of the file header */
+        const static size_t HEADER_SIZE{8};
+
+        /* Size of the sizes preceding each entry in the data section */
+        const static size_t PREFIX_SIZE{12};
+
+        /* Size of an entry of the entry table */
+        const static size_t ENTRY_SIZE{32};
+
+        /* Size of the file footer */
+        const static size_t FOOTER_SIZE{32};
+
+        /* Format revision of the pack file */
+        const static uint32_t REVISION{2};
+
+        /* Maximum number of entries, their hash table slot count must fit its 4 bytes */
+        const static size_t MAX_ENTRIES{size_t{1} << 30};
+
+        /*
+         * Pre-Conditions:
+         *      Path of the pack file,
+         *      optional matrix encoding of the records (default the smaller one),
+         *      optional append mode (default false).
+         *
+         * Post-Conditions:
+         *      Creates the pack file, replacing any existing one,
+         *      or in append mode reopens it & keeps its entries. The index of a closed pack
+         *      is dropped until the next close, an unclosed pack is cut after its last whole entry.
+         *      Throws an invalid argument exception if the file cannot be created
+         *      or an existing file is not a pack file, & a length error if it is too large to append to.
+         */
+        explicit PackWriter(const std::string&, MatrixEncoding encoding = MatrixEncoding::AUTO, bool append = false);
+
+        PackWriter(const PackWriter&) = delete;
+
+        PackWriter& operator=(const PackWriter&) = delete;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Closes the pack file if close was not called, errors are ignored.
+         */
+        ~PackWriter();
+
+        /*
+         * Pre-Conditions:
+         *      Key of the entry,
+         *      QR code,
+         *      optional rendered image bytes.
+         *
+         * Post-Conditions:
+         *      Appends the entry, a later entry with the same key replaces the earlier one.
+         *      Throws a domain error exception if the pack is closed,
+         *      & a length error if the key or an entry part exceeds 4 GiB, or the pack is full (Check MAX_ENTRIES).
+         */
+        void add(std::string_view, const QrCode&, const std::vector<uint8_t>& image = {});
+
+        /*
+         * Pre-Conditions:
+         *      Keys & data strings of the QR codes,
+         *      ECL of all the QR codes,
+         *      optional number of worker threads (0 for the hardware concurrency).
+         *
+         * Post-Conditions:
+         *      Encodes the QR codes in parallel & appends them in order, without images.
+         */
+        void addAll(const std::vector<std::pair<std::string, std::wstring>>&, Ecl, int threads = 0);
+
+        /*
+         * Pre-Conditions:
+         *      Keys & data strings of the QR codes,
+         *      ECL of all the QR codes,
+         *      image format (not JPEG),
+         *      render options,
+         *      optional number of worker threads (0 for the hardware concurrency).
+         *
+         * Post-Conditions:
+         *      Encodes & renders the QR codes in parallel & appends them in order.
+         */
+        void addAll(const std::vector<std::pair<std::string, std::wstring>>&, Ecl, ImageFormat, const RenderOptions&,
+                    int threads = 0);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of entries added.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Pushes the entries added so far to the file, so they survive a crash
+         *      & can be recovered in append mode.
+         *      Throws a domain error exception if the file could not be written.
+         */
+        void flush();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Writes the index & the footer, then closes the file. Does nothing if already closed.
+         *      Throws a domain error exception if the file could not be written.
+         */
+        void close();
+
+        /*
+         * Pre-Conditions:
+         *      Key bytes.
+         *
+         * Post-Conditions:
+         *      Returns the 64 bit FNV-1a hash of the key.
+         */
+        [[nodiscard]] static uint64_t getHash(std::string_view);
+
+    private:
+        /*
+         * Entry of the index, kept in memory until close.
+         */
+        class Entry final {
+        public:
+            uint64_t hash;
+
+            uint64_t offset;
+
+            /* Position of the key in keys */
+            size_t key_position;
+
+            uint32_t key_size;
+
+            uint32_t record_size;
+
+            uint32_t image_size;
+        };
+
+        std::ofstream file;
+
+        MatrixEncoding encoding;
+
+        /* Bytes written so far */
+        uint64_t offset{HEADER_SIZE};
+
+        std::vector<Entry> entries{};
+
+        /* Keys of the entries, back to back, to resolve hash collisions at close */
+        std::string keys{};
+
+        bool closed{false};
+
+        /*
+         * Pre-Conditions:
+         *      Path of an existing pack file.
+         *
+         * Post-Conditions:
+         *      Loads the entries of the data section & returns the offset following the last whole one.
+         *      Throws an invalid argument exception if the file is not a pack file,
+         *      & a length error if it holds more than MAX_ENTRIES entries.
+         */
+        uint64_t recover(const std::string&);
+
+        /*
+         * Pre-Conditions:
+         *      Key of the entry,
+         *      record bytes,
+         *      image bytes.
+         *
+         * Post-Conditions:
+         *      Appends the entry.
+         *      Throws a domain error exception if the pack is closed,
+         *      & a length error if a part exceeds 4 GiB or the pack is full.
+         */
+        void append(std::string_view, const std::vector<uint8_t>&, const std::vector<uint8_t>&);
+
+        /*
+         * Pre-Conditions:
+         *      Keys & data strings of the QR codes,
+         *      ECL of all the QR codes,
+         *      renderer of the image bytes (empty function for none),
+         *      number of worker threads (0 for the hardware concurrency).
+         *
+         * Post-Conditions:
+         *      Encodes the QR codes in parallel blocks & appends them in order.
+         */
+        void addAll(const std::vector<std::pair<std::string, std::wstring>>&, Ecl,
+                    const std::function<std::vector<uint8_t>(const QrCode&)>&, int);
+
+        /*
+         * Pre-Conditions:
+         *      Value,
+         *      number of bytes (4 or 8),
+         *      output buffer.
+         *
+         * Post-Conditions:
+         *      Appends the value in little endian order.
+         */
+        static void putInteger(uint64_t, size_t, std::string&);
+    };
+}
+
+
+#endif //QR_IO_PACKWRITER_H
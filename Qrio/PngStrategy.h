@@ -0,0 +1,48 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_PNGSTRATEGY_H
+#define QR_IO_PNGSTRATEGY_H
+
+
+namespace Qrio {
+    /*
+     * Enumerates the compression strategies of PNG images,
+     * each corresponds to the zlib strategy of the same name.
+     * DEFAULT: Regular deflate,
+     * FILTERED: Tuned for filtered rows with small values,
+     * HUFFMAN_ONLY: No string matching, fastest,
+     * RLE: Matches limited to runs, suits the long runs of QR codes,
+     * FIXED: Fixed Huffman codes, no dynamic tables.
+     */
+    enum class PngStrategy {
+        DEFAULT = 0,
+        FILTERED = 1,
+        HUFFMAN_ONLY = 2,
+        RLE = 3,
+        FIXED = 4,
+    };
+}
+
+
+#endif //QR_IO_PNGSTRATEGY_H
@@ -0,0 +1,297 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BitmapWriter.h"
+#include "PrinterWriter.h"
+
+
+namespace Qrio {
+    using std::length_error, std::min, std::string, std::to_string, std::vector;
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in dots (default 10 dots),
+     *      optional border width in modules (default 4X, Check 6.3.8).
+     *
+     * Post-Conditions:
+     *      Returns an ESC/POS GS v 0 raster bit image command (normal density):
+     *      GS v 0 m xL xH yL yH, then the rows of x bytes, a set bit prints a dot.
+     *      Throws a length error if the image exceeds 65535 rows or row bytes.
+     */
+    vector<uint8_t> PrinterWriter::toEscPos(const SquareMatrix& matrix, int scale, int border_width) {
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const size_t stride{(side + 7) / 8};
+
+        if (side > 0xFFFF) {
+            throw length_error("ESC/POS raster images are limited to 65535 rows");
+        }
+
+        vector<uint8_t> result{0x1D, 'v', '0', 0,
+                               static_cast<uint8_t>(stride), static_cast<uint8_t>(stride >> 8),
+                               static_cast<uint8_t>(side), static_cast<uint8_t>(side >> 8)};
+        vector<uint8_t> line(stride);
+
+        result.reserve(result.size() + stride * side);
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            BitmapWriter::packRow(matrix, quiet ? S : i - border_width, scale, border_width, true, line.data());
+
+            for (int k{0}; k < scale; k++) {
+                result.insert(result.end(), line.begin(), line.end());
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in dots (default 10 dots),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional ZPL ASCII compression (default on).
+     *
+     * Post-Conditions:
+     *      Returns a ZPL II label with the QR code as a ^GFA graphic field at the origin,
+     *      the data is hexadecimal, a set bit prints a dot.
+     *      Compressed rows repeat the previous row with ':', end in zeros with ',' or in ones with '!',
+     *      & shorten runs of a digit with repeat counts.
+     */
+    string PrinterWriter::toZpl(const SquareMatrix& matrix, int scale, int border_width, bool compress) {
+        const static char DIGITS[]{"0123456789ABCDEF"};
+
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const size_t stride{(side + 7) / 8};
+        const string total{to_string(stride * side)};
+
+        string result{"^XA\n^FO0,0^GFA," + total + "," + total + "," + to_string(stride) + ","};
+        vector<uint8_t> line(stride), previous{};
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            BitmapWriter::packRow(matrix, quiet ? S : i - border_width, scale, border_width, true, line.data());
+
+            for (int k{0}; k < scale; k++) {
+                if (compress) {
+                    result += getZplRow(line, previous);
+                    previous = line;
+                    continue;
+                }
+
+                for (uint8_t byte: line) {
+                    result += DIGITS[byte >> 4];
+                    result += DIGITS[byte & 0xF];
+                }
+            }
+        }
+
+        return result + "^FS\n^XZ\n";
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Row major QR matrix,
+     *      optional scale in dots (default 10 dots),
+     *      optional border width in modules (default 4X, Check 6.3.8),
+     *      optional resolution in DPI (default 300 DPI).
+     *
+     * Post-Conditions:
+     *      Returns a PCL raster graphic at the cursor position:
+     *      resolution, width, & height, start raster, one transfer raster data command per row, end raster.
+     *      The first dot row of each module row is compressed with TIFF PackBits (mode 2),
+     *      the others are empty delta rows (mode 3) repeating it, a set bit prints a dot.
+     */
+    vector<uint8_t> PrinterWriter::toPcl(const SquareMatrix& matrix, int scale, int border_width, int resolution) {
+        const size_t S{matrix.size()};
+        const size_t side{(S + 2 * border_width) * scale};
+        const size_t stride{(side + 7) / 8};
+
+        const string header{"\x1B*t" + to_string(resolution) + "R"
+                            + "\x1B*r" + to_string(side) + "S"
+                            + "\x1B*r" + to_string(side) + "T"
+                            + "\x1B*r1A"};
+        const string footer{"\x1B*rC"};
+
+        /* Compression modes 2 (PackBits) & 3 (delta row), an empty delta row repeats the seed row */
+        const string packbits{"\x1B*b2M"}, delta{"\x1B*b3M"}, repeat{"\x1B*b0W"};
+
+        vector<uint8_t> result{header.begin(), header.end()}, line(stride), packed{};
+
+        for (size_t i{0}; i < S + 2 * border_width; i++) {
+            const bool quiet{i < static_cast<size_t>(border_width) or i >= S + border_width};
+
+            BitmapWriter::packRow(matrix, quiet ? S : i - border_width, scale, border_width, true, line.data());
+
+            packed.clear();
+            appendPackBits(packed, line);
+
+            const string transfer{packbits + "\x1B*b" + to_string(packed.size()) + "W"};
+
+            result.insert(result.end(), transfer.begin(), transfer.end());
+            result.insert(result.end(), packed.begin(), packed.end());
+
+            /* The other dot rows of the module row repeat it */
+            if (scale > 1) {
+                result.insert(result.end(), delta.begin(), delta.end());
+            }
+
+            for (int k{1}; k < scale; k++) {
+                result.insert(result.end(), repeat.begin(), repeat.end());
+            }
+        }
+
+        result.insert(result.end(), footer.begin(), footer.end());
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Packed scanline,
+     *      previous packed scanline (empty for the first row).
+     *
+     * Post-Conditions:
+     *      Returns the ZPL ASCII compressed hexadecimal data of the scanline.
+     */
+    string PrinterWriter::getZplRow(const vector<uint8_t>& line, const vector<uint8_t>& previous) {
+        const static char DIGITS[]{"0123456789ABCDEF"};
+
+        if (line == previous) {
+            return ":";
+        }
+
+        string hex(2 * line.size(), '0'), result{};
+
+        result.reserve(hex.size() + 1);
+
+        for (size_t i{0}; i < line.size(); i++) {
+            hex[2 * i] = DIGITS[line[i] >> 4];
+            hex[2 * i + 1] = DIGITS[line[i] & 0xF];
+        }
+
+        /* Trailing zeros or ones are implied by a single marker, the digits end before them */
+        const char last{hex.back()};
+        const char marker{last == '0' ? ',' : last == 'F' ? '!' : '\0'};
+        const size_t length{marker == '\0' ? hex.size() : hex.find_last_not_of(last) + 1};
+
+        for (size_t i{0}; i < length;) {
+            size_t end{i + 1};
+
+            while (end < length and hex[end] == hex[i]) {
+                end++;
+            }
+
+            appendZplRun(result, end - i, hex[i]);
+            i = end;
+        }
+
+        if (marker != '\0') {
+            result.push_back(marker);
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output ZPL data,
+     *      run length,
+     *      repeated hexadecimal digit.
+     *
+     * Post-Conditions:
+     *      Appends the run using the ZPL repeat counts (G to Y for 1 to 19, g to z for 20 to 400),
+     *      runs of up to 2 digits are written as is.
+     */
+    void PrinterWriter::appendZplRun(string& output, size_t length, char digit) {
+        if (length <= 2) {
+            output.append(length, digit);
+            return;
+        }
+
+        while (length >= 20) {
+            const size_t twenties{min(length / 20, size_t{20})};
+
+            output += static_cast<char>('f' + twenties);
+            length -= twenties * 20;
+        }
+
+        if (length != 0) {
+            output += static_cast<char>('F' + length);
+        }
+
+        output += digit;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output bytes,
+     *      packed scanline.
+     *
+     * Post-Conditions:
+     *      Appends the scanline compressed with TIFF PackBits:
+     *      a control byte n in [0, 127] is followed by n + 1 literal bytes,
+     *      n in [-127, -1] by one byte repeated 1 - n times.
+     */
+    void PrinterWriter::appendPackBits(vector<uint8_t>& output, const vector<uint8_t>& line) {
+        const size_t N{line.size()};
+        size_t i{0};
+
+        while (i < N) {
+            size_t end{i + 1};
+
+            while (end < N and end - i < 128 and line[end] == line[i]) {
+                end++;
+            }
+
+            if (end - i >= 2) {
+                output.push_back(static_cast<uint8_t>(257 - (end - i)));
+                output.push_back(line[i]);
+                i = end;
+                continue;
+            }
+
+            /* Literal run, up to the next repeated pair */
+            end = i + 1;
+
+            while (end < N and end - i < 128 and not (end + 1 < N and line[end] == line[end + 1])) {
+                end++;
+            }
+
+            output.push_back(static_cast<uint8_t>(end - i - 1));
+            output.insert(output.end(), line.begin() + static_cast<long>(i), line.begin() + static_cast<long>(end));
+            i = end;
+        }
+    }
+}
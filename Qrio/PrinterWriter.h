@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_PRINTERWRITER_H
+#define QR_IO_PRINTERWRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SquareMatrix.h"
+
+
+namespace Qrio {
+    /*
+     * PrinterWriter: 1.0
+     *
+     * Writes a QR matrix as printer native raster data (ESC/POS, ZPL, or PCL),
+     * straight from packed 1 bit scanlines, so label printers need no image decoding.
+     * The scale is in printer dots, dark modules are printed, colors do not apply.
+     */
+    class PrinterWriter final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in dots (default 10 dots),
+         *      optional border width in modules (default 4X, Check 6.3.8).
+         *
+         * Post-Conditions:
+         *      Returns an ESC/POS GS v 0 raster bit image command (normal density).
+         *      Throws a length error if the image exceeds 65535 rows or row bytes.
+         */
+        [[nodiscard]] static std::vector<uint8_t> toEscPos(const SquareMatrix&,
+                                                           int scale = 10,
+                                                           int border_width = 4);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in dots (default 10 dots),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional ZPL ASCII compression (default on).
+         *
+         * Post-Conditions:
+         *      Returns a ZPL II label with the QR code as a ^GFA graphic field at the origin.
+         */
+        [[nodiscard]] static std::string toZpl(const SquareMatrix&,
+                                               int scale = 10,
+                                               int border_width = 4,
+                                               bool compress = true);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional scale in dots (default 10 dots),
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional resolution in DPI (default 300 DPI).
+         *
+         * Post-Conditions:
+         *      Returns a PCL raster graphic at the cursor position, each module row is
+         *      sent once with TIFF PackBits (mode 2) & repeated with empty delta rows (mode 3).
+         */
+        [[nodiscard]] static std::vector<uint8_t> toPcl(const SquareMatrix&,
+                                                        int scale = 10,
+                                                        int border_width = 4,
+                                                        int resolution = 300);
+
+    private:
+        /*
+         * Pre-Conditions:
+         *      Packed scanline,
+         *      previous packed scanline (empty for the first row).
+         *
+         * Post-Conditions:
+         *      Returns the ZPL ASCII compressed hexadecimal data of the scanline.
+         */
+        [[nodiscard]] static std::string getZplRow(const std::vector<uint8_t>&, const std::vector<uint8_t>&);
+
+        /*
+         * Pre-Conditions:
+         *      Output ZPL data,
+         *      run length,
+         *      repeated hexadecimal digit.
+         *
+         * Post-Conditions:
+         *      Appends the run using the ZPL repeat counts (G to Y for 1 to 19, g to z for 20 to 400).
+         */
+        static void appendZplRun(std::string&, size_t, char);
+
+        /*
+         * Pre-Conditions:
+         *      Output bytes,
+         *      packed scanline.
+         *
+         * Post-Conditions:
+         *      Appends the scanline compressed with TIFF PackBits.
+         */
+        static void appendPackBits(std::vector<uint8_t>&, const std::vector<uint8_t>&);
+    };
+}
+
+
+#endif //QR_IO_PRINTERWRITER_H
@@ -0,0 +1,412 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "Profiler.h"
+
+
+namespace Qrio {
+    using std::chrono::steady_clock, std::chrono::duration_cast, std::chrono::nanoseconds,
+          std::memory_order_relaxed, std::max;
+
+    thread_local StageProfile Profiler::pending{};
+
+    thread_local Profiler::Scope* Profiler::top{nullptr};
+
+    thread_local uint64_t Profiler::allocations{0};
+
+    thread_local uint64_t Profiler::bytes{0};
+
+    thread_local int64_t Profiler::heap{0};
+
+    thread_local int64_t Profiler::heap_peak{0};
+
+    std::array<std::atomic<uint64_t>, STAGE_COUNT> Profiler::total_calls{};
+
+    std::array<std::atomic<uint64_t>, STAGE_COUNT> Profiler::total_nanoseconds{};
+
+    std::array<std::atomic<uint64_t>, STAGE_COUNT> Profiler::total_allocations{};
+
+    std::array<std::atomic<uint64_t>, STAGE_COUNT> Profiler::total_bytes{};
+
+    std::array<std::atomic<uint64_t>, STAGE_COUNT> Profiler::total_peak_bytes{};
+
+    std::atomic<uint64_t> Profiler::total_probes{0};
+
+    std::atomic<uint64_t> Profiler::total_symbols{0};
+
+    std::atomic<int64_t> Profiler::heap_size{0};
+
+    std::atomic<int64_t> Profiler::peak_heap_size{0};
+
+    /*
+     * Pre-Conditions:
+     *      Stage.
+     *
+     * Post-Conditions:
+     *      Starts recording the stage on the current thread.
+     */
+    Profiler::Scope::Scope(Stage stage):
+            stage{stage},
+            parent{top},
+            active{parent == nullptr or parent->stage != Stage::VERSION_SEARCH},
+            start{steady_clock::now()},
+            start_allocations{allocations},
+            start_bytes{bytes},
+            start_heap{heap},
+            outer_peak{heap_peak} {
+        if (active) {
+            top = this;
+            heap_peak = heap;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Adds the time & allocations of the stage to the profiles.
+     */
+    Profiler::Scope::~Scope() {
+        if (not active) {
+            return;
+        }
+
+        const auto elapsed{static_cast<uint64_t>(
+                duration_cast<nanoseconds>(steady_clock::now() - start).count())};
+        const uint64_t allocated{allocations - start_allocations}, allocated_bytes{bytes - start_bytes};
+
+        record(stage, elapsed - child_nanoseconds, allocated - child_allocations,
+               allocated_bytes - child_bytes, static_cast<uint64_t>(max(int64_t{0}, heap_peak - start_heap)));
+
+        if (parent != nullptr) {
+            parent->child_nanoseconds += elapsed;
+            parent->child_allocations += allocated;
+            parent->child_bytes += allocated_bytes;
+        }
+
+        top = parent;
+        heap_peak = max(outer_peak, heap_peak);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Discards the stages recorded on the current thread since the last QR code,
+     *      returns an empty profile.
+     */
+    StageProfile Profiler::begin() {
+        pending = StageProfile{};
+
+        return {};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the profile of the QR code built on the current thread
+     *      & starts the next one.
+     */
+    StageProfile Profiler::take() {
+        StageProfile result{pending};
+        result.symbols = 1;
+        pending = StageProfile{};
+
+        total_symbols.fetch_add(1, memory_order_relaxed);
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Counts one version tried by the version search.
+     */
+    void Profiler::addProbe() {
+        pending.probes++;
+        total_probes.fetch_add(1, memory_order_relaxed);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Number of bytes.
+     *
+     * Post-Conditions:
+     *      Counts one allocation of the current thread (called by operator new).
+     */
+    void Profiler::addAllocation(size_t size) {
+        allocations++;
+        bytes += size;
+
+#ifdef QRIO_HEAP_PROFILING
+        heap += static_cast<int64_t>(size);
+        heap_peak = max(heap_peak, heap);
+
+        const int64_t current{heap_size.fetch_add(static_cast<int64_t>(size), memory_order_relaxed)
+                              + static_cast<int64_t>(size)};
+        int64_t peak{peak_heap_size.load(memory_order_relaxed)};
+
+        while (peak < current and not peak_heap_size.compare_exchange_weak(peak, current, memory_order_relaxed)) {}
+#endif
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Number of bytes.
+     *
+     * Post-Conditions:
+     *      Counts one deallocation of the current thread (called by operator delete).
+     */
+    void Profiler::addDeallocation(size_t size) {
+        heap -= static_cast<int64_t>(size);
+        heap_size.fetch_sub(static_cast<int64_t>(size), memory_order_relaxed);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of allocations of the current thread.
+     */
+    uint64_t Profiler::getThreadAllocations() {
+        return allocations;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the bytes allocated by the current thread.
+     */
+    uint64_t Profiler::getThreadBytes() {
+        return bytes;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the bytes allocated minus the ones freed by the current thread,
+     *      negative if it freed memory of other threads (only with QRIO_HEAP_PROFILING).
+     */
+    int64_t Profiler::getThreadHeapSize() {
+        return heap;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the bytes in use through operator new (only with QRIO_HEAP_PROFILING).
+     */
+    int64_t Profiler::getHeapSize() {
+        return heap_size.load(memory_order_relaxed);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the peak of the bytes in use since the start or the last reset
+     *      (only with QRIO_HEAP_PROFILING).
+     */
+    int64_t Profiler::getPeakHeapSize() {
+        return peak_heap_size.load(memory_order_relaxed);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the stages summed over all the threads since the start or the last reset.
+     */
+    StageProfile Profiler::getTotal() {
+        StageProfile result{};
+
+        for (size_t i{0}; i < STAGE_COUNT; i++) {
+            result.calls[i] = total_calls[i].load(memory_order_relaxed);
+            result.nanoseconds[i] = total_nanoseconds[i].load(memory_order_relaxed);
+            result.allocations[i] = total_allocations[i].load(memory_order_relaxed);
+            result.bytes[i] = total_bytes[i].load(memory_order_relaxed);
+            result.peak_bytes[i] = total_peak_bytes[i].load(memory_order_relaxed);
+        }
+
+        result.probes = total_probes.load(memory_order_relaxed);
+        result.symbols = total_symbols.load(memory_order_relaxed);
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Clears the process-wide profile & restarts the peak heap size from the current one.
+     */
+    void Profiler::reset() {
+        for (size_t i{0}; i < STAGE_COUNT; i++) {
+            total_calls[i].store(0, memory_order_relaxed);
+            total_nanoseconds[i].store(0, memory_order_relaxed);
+            total_allocations[i].store(0, memory_order_relaxed);
+            total_bytes[i].store(0, memory_order_relaxed);
+            total_peak_bytes[i].store(0, memory_order_relaxed);
+        }
+
+        total_probes.store(0, memory_order_relaxed);
+        total_symbols.store(0, memory_order_relaxed);
+        peak_heap_size.store(heap_size.load(memory_order_relaxed), memory_order_relaxed);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Stage.
+     *
+     * Post-Conditions:
+     *      Returns the lower case name of the stage (e.g. "mask_search").
+     */
+    const char* Profiler::getName(Stage stage) {
+        const static char* NAMES[STAGE_COUNT]{
+            "escapes", "version_search", "analysis", "encoding",
+            "error_correction", "structure", "mask_search", "rendering", "detection"
+        };
+
+        return NAMES[static_cast<size_t>(stage)];
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Stage,
+     *      wall time in nanoseconds,
+     *      number of allocations,
+     *      bytes allocated,
+     *      peak heap growth.
+     *
+     * Post-Conditions:
+     *      Adds the stage to the profiles.
+     */
+    void Profiler::record(Stage stage, uint64_t elapsed, uint64_t allocated, uint64_t allocated_bytes,
+                          uint64_t peak) {
+        const auto i{static_cast<size_t>(stage)};
+
+        if (stage != Stage::RENDERING) {
+            pending.calls[i]++;
+            pending.nanoseconds[i] += elapsed;
+            pending.allocations[i] += allocated;
+            pending.bytes[i] += allocated_bytes;
+            pending.peak_bytes[i] = max(pending.peak_bytes[i], peak);
+        }
+
+        total_calls[i].fetch_add(1, memory_order_relaxed);
+        total_nanoseconds[i].fetch_add(elapsed, memory_order_relaxed);
+        total_allocations[i].fetch_add(allocated, memory_order_relaxed);
+        total_bytes[i].fetch_add(allocated_bytes, memory_order_relaxed);
+
+        uint64_t total_peak{total_peak_bytes[i].load(memory_order_relaxed)};
+
+        while (total_peak < peak
+               and not total_peak_bytes[i].compare_exchange_weak(total_peak, peak, memory_order_relaxed)) {}
+    }
+}
+
+#ifdef QRIO_HEAP_PROFILING
+/* Size prefix of each allocation, keeping the fundamental alignment */
+constexpr size_t HEADER_SIZE{alignof(std::max_align_t)};
+
+/*
+ * Pre-Conditions:
+ *      Number of bytes.
+ *
+ * Post-Conditions:
+ *      Replaces the global operator new to track the allocations & heap size of each thread,
+ *      the size is stored before the returned memory.
+ *      Throws a bad_alloc exception if the memory is exhausted.
+ */
+void* operator new(size_t size) {
+    if (auto* block{static_cast<unsigned char*>(std::malloc(size + HEADER_SIZE))}) {
+        *reinterpret_cast<size_t*>(block) = size;
+        Qrio::Profiler::addAllocation(size);
+
+        return block + HEADER_SIZE;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        unsigned char* block{static_cast<unsigned char*>(pointer) - HEADER_SIZE};
+
+        Qrio::Profiler::addDeallocation(*reinterpret_cast<size_t*>(block));
+        std::free(block);
+    }
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+#elif defined(QRIO_PROFILING)
+/*
+ * Pre-Conditions:
+ *      Number of bytes.
+ *
+ * Post-Conditions:
+ *      Replaces the global operator new to count the allocations of each thread.
+ *      Throws a bad_alloc exception if the memory is exhausted.
+ */
+void* operator new(size_t size) {
+    Qrio::Profiler::addAllocation(size);
+
+    if (void* pointer{std::malloc(size == 0 ? 1 : size)}) {
+        return pointer;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+#endif
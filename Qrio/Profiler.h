@@ -0,0 +1,290 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_PROFILER_H
+#define QR_IO_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "Stage.h"
+#include "StageProfile.h"
+
+/*
+ * Instrumentation of the pipeline stages, compiled in with QRIO_PROFILING
+ * (CMake option QRIO_WITH_PROFILING), otherwise the macros expand to nothing.
+ * QRIO_HEAP_PROFILING (CMake option QRIO_WITH_HEAP_PROFILING) also tracks the heap size.
+ */
+#ifdef QRIO_PROFILING
+#define QRIO_PROFILE_STAGE(stage) const Qrio::Profiler::Scope qrio_profile_scope{stage}
+#define QRIO_PROFILE_PROBE() Qrio::Profiler::addProbe()
+#else
+#define QRIO_PROFILE_STAGE(stage) static_cast<void>(0)
+#define QRIO_PROFILE_PROBE() static_cast<void>(0)
+#endif
+
+
+namespace Qrio {
+    /*
+     * Profiler: 1.0
+     *
+     * Records the wall time & allocations of the pipeline stages, per thread for the
+     * QR code being built (QrCode::getProfile) & summed process-wide (getTotal).
+     * Allocations & their bytes are counted by the operator new replaced in profiling builds.
+     * Heap profiling builds prefix each allocation with its size, so operator delete
+     * tracks the heap size & its peaks.
+     * Stages nested in the version search are charged to it, since they are its probes.
+     * Rendering happens after the construction, so it is only summed process-wide.
+     */
+    class Profiler final {
+    public:
+        /*
+         * Records one stage for its lifetime, excluding the stages nested in it.
+         */
+        class Scope final {
+        public:
+            /*
+             * Pre-Conditions:
+             *      Stage.
+             *
+             * Post-Conditions:
+             *      Starts recording the stage on the current thread.
+             */
+            explicit Scope(Stage);
+
+            Scope(const Scope&) = delete;
+
+            Scope& operator=(const Scope&) = delete;
+
+            /*
+             * Pre-Conditions:
+             *      None.
+             *
+             * Post-Conditions:
+             *      Adds the time & allocations of the stage to the profiles.
+             */
+            ~Scope();
+
+        private:
+            Stage stage;
+
+            Scope* parent;
+
+            bool active;
+
+            std::chrono::steady_clock::time_point start;
+
+            uint64_t start_allocations;
+
+            uint64_t start_bytes;
+
+            /* Heap size of the thread at the start & peak of the enclosing scope */
+            int64_t start_heap;
+
+            int64_t outer_peak;
+
+            uint64_t child_nanoseconds{0};
+
+            uint64_t child_allocations{0};
+
+            uint64_t child_bytes{0};
+        };
+
+        Profiler() = delete;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Discards the stages recorded on the current thread since the last QR code,
+         *      returns an empty profile.
+         */
+        static StageProfile begin();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the profile of the QR code built on the current thread
+         *      & starts the next one.
+         */
+        static StageProfile take();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Counts one version tried by the version search.
+         */
+        static void addProbe();
+
+        /*
+         * Pre-Conditions:
+         *      Number of bytes.
+         *
+         * Post-Conditions:
+         *      Counts one allocation of the current thread (called by operator new).
+         */
+        static void addAllocation(size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Number of bytes.
+         *
+         * Post-Conditions:
+         *      Counts one deallocation of the current thread (called by operator delete).
+         */
+        static void addDeallocation(size_t);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of allocations of the current thread.
+         */
+        static uint64_t getThreadAllocations();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the bytes allocated by the current thread.
+         */
+        static uint64_t getThreadBytes();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the bytes allocated minus the ones freed by the current thread,
+         *      negative if it freed memory of other threads (only with QRIO_HEAP_PROFILING).
+         */
+        static int64_t getThreadHeapSize();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the bytes in use through operator new (only with QRIO_HEAP_PROFILING).
+         */
+        static int64_t getHeapSize();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the peak of the bytes in use since the start or the last reset
+         *      (only with QRIO_HEAP_PROFILING).
+         */
+        static int64_t getPeakHeapSize();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the stages summed over all the threads since the start or the last reset.
+         */
+        static StageProfile getTotal();
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Clears the process-wide profile & restarts the peak heap size from the current one.
+         */
+        static void reset();
+
+        /*
+         * Pre-Conditions:
+         *      Stage.
+         *
+         * Post-Conditions:
+         *      Returns the lower case name of the stage (e.g. "mask_search").
+         */
+        static const char* getName(Stage);
+
+    private:
+        /* Stages of the QR code being built on the thread */
+        static thread_local StageProfile pending;
+
+        /* Innermost active scope of the thread */
+        static thread_local Scope* top;
+
+        /* Number of allocations of the thread */
+        static thread_local uint64_t allocations;
+
+        /* Bytes allocated by the thread */
+        static thread_local uint64_t bytes;
+
+        /* Bytes allocated minus the ones freed by the thread, & its peak in the innermost scope */
+        static thread_local int64_t heap;
+
+        static thread_local int64_t heap_peak;
+
+        static std::array<std::atomic<uint64_t>, STAGE_COUNT> total_calls;
+
+        static std::array<std::atomic<uint64_t>, STAGE_COUNT> total_nanoseconds;
+
+        static std::array<std::atomic<uint64_t>, STAGE_COUNT> total_allocations;
+
+        static std::array<std::atomic<uint64_t>, STAGE_COUNT> total_bytes;
+
+        static std::array<std::atomic<uint64_t>, STAGE_COUNT> total_peak_bytes;
+
+        static std::atomic<uint64_t> total_probes;
+
+        static std::atomic<uint64_t> total_symbols;
+
+        static std::atomic<int64_t> heap_size;
+
+        static std::atomic<int64_t> peak_heap_size;
+
+        /*
+         * Pre-Conditions:
+         *      Stage,
+         *      wall time in nanoseconds,
+         *      number of allocations,
+         *      bytes allocated,
+         *      peak heap growth.
+         *
+         * Post-Conditions:
+         *      Adds the stage to the profiles.
+         */
+        static void record(Stage, uint64_t, uint64_t, uint64_t, uint64_t);
+    };
+}
+
+
+#endif //QR_IO_PROFILER_H
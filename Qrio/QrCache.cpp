@@ -0,0 +1,359 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "QrCache.h"
+
+
+namespace Qrio {
+    using std::function, std::hash, std::holds_alternative, std::invalid_argument,
+            std::lock_guard, std::make_shared, std::move, std::shared_ptr, std::string,
+            std::variant, std::vector, std::wstring;
+
+    /*
+     * Pre-Conditions:
+     *      Same arguments as the QrCode constructor.
+     *
+     * Post-Conditions:
+     *      Stores the given payload & options.
+     */
+    QrCache::Key::Key(variant<wstring, string> data, Ecl ecl, Designator override_mode,
+                      int version, int mask, int fnc1, int struct_id, int struct_count,
+                      MaskPolicy mask_policy):
+                      data{move(data)}, ecl{ecl}, override_mode{override_mode},
+                      version{version}, mask{mask}, fnc1{fnc1}, struct_id{struct_id},
+                      struct_count{struct_count}, mask_policy{mask_policy} {}
+
+    /*
+     * Pre-Conditions:
+     *      Memory budget in bytes shared by all shards,
+     *      optional number of shards (must be positive).
+     *
+     * Post-Conditions:
+     *      Creates an empty cache.
+     *      Throws an invalid argument exception if the number of shards is 0.
+     */
+    QrCache::QrCache(size_t memory_budget, size_t shard_count):
+                     shard_budget{shard_count == 0 ? 0 : memory_budget / shard_count},
+                     shards(shard_count) {
+        if (shard_count == 0) {
+            throw invalid_argument("QrCache requires at least one shard");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key of the QR code.
+     *
+     * Post-Conditions:
+     *      Returns the cached QR code,
+     *      otherwise generates & caches it (if it fits in its shard).
+     *      Generation errors are propagated & nothing is cached.
+     */
+    shared_ptr<const QrCode> QrCache::get(const Key& key) {
+        EntryKey entry_key{key, {}};
+        Entry entry{find(entry_key)};
+
+        if (entry.symbol) {
+            hits++;
+            return entry.symbol;
+        }
+
+        misses++;
+
+        /* Generated outside the lock, concurrent misses of the same key are tolerated */
+        entry.symbol = make_shared<const QrCode>(key.data, key.ecl, key.override_mode,
+                                                 key.version, key.mask, key.fnc1,
+                                                 key.struct_id, key.struct_count,
+                                                 key.mask_policy);
+        entry.cost = getCost(entry_key) + getCost(*entry.symbol);
+        entry.key = move(entry_key);
+
+        insert(entry);
+
+        return entry.symbol;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Key of the QR code,
+     *      name of the rendering (format & options, e.g. "png:scale=4"),
+     *      function rendering a QR code into bytes.
+     *
+     * Post-Conditions:
+     *      Returns the cached bytes of the rendering,
+     *      otherwise renders the (possibly cached) QR code & caches the bytes.
+     */
+    shared_ptr<const vector<uint8_t>> QrCache::getRendered(
+            const Key& key,
+            const string& rendering,
+            const function<vector<uint8_t>(const QrCode&)>& render) {
+        if (rendering.empty()) {
+            throw invalid_argument("Rendering name must not be empty");
+        }
+
+        EntryKey entry_key{key, rendering};
+        Entry entry{find(entry_key)};
+
+        if (entry.bytes) {
+            hits++;
+            return entry.bytes;
+        }
+
+        misses++;
+
+        entry.bytes = make_shared<const vector<uint8_t>>(render(*get(key)));
+        entry.cost = getCost(entry_key) + entry.bytes->size();
+        entry.key = move(entry_key);
+
+        insert(entry);
+
+        return entry.bytes;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of lookups served from the cache.
+     */
+    size_t QrCache::getHits() const {
+        return hits;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of lookups that required generation.
+     */
+    size_t QrCache::getMisses() const {
+        return misses;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of entries evicted to respect the budget.
+     */
+    size_t QrCache::getEvictions() const {
+        return evictions;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the approximate memory used by the cached entries in bytes.
+     */
+    size_t QrCache::getMemoryUsage() const {
+        size_t result{0};
+
+        for (const auto& shard: shards) {
+            lock_guard lock{shard.mutex};
+            result += shard.usage;
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of cached entries.
+     */
+    size_t QrCache::size() const {
+        size_t result{0};
+
+        for (const auto& shard: shards) {
+            lock_guard lock{shard.mutex};
+            result += shard.entries.size();
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Removes all entries, the counters are kept.
+     */
+    void QrCache::clear() {
+        for (auto& shard: shards) {
+            lock_guard lock{shard.mutex};
+            shard.index.clear();
+            shard.entries.clear();
+            shard.usage = 0;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry key.
+     *
+     * Post-Conditions:
+     *      Returns the hash of all the options & the rendering name.
+     */
+    size_t QrCache::EntryHash::operator()(const EntryKey& entry_key) const {
+        const Key& key{entry_key.key};
+        size_t result{hash<variant<wstring, string>>{}(key.data)};
+
+        /* Boost's hash_combine */
+        const auto combine{[&result](size_t value) {
+            result ^= value + 0x9E3779B9 + (result << 6) + (result >> 2);
+        }};
+
+        combine(static_cast<size_t>(key.ecl));
+        combine(static_cast<size_t>(key.override_mode));
+        combine(static_cast<size_t>(key.version));
+        combine(static_cast<size_t>(key.mask));
+        combine(static_cast<size_t>(key.fnc1));
+        combine(static_cast<size_t>(key.struct_id));
+        combine(static_cast<size_t>(key.struct_count));
+        combine(static_cast<size_t>(key.mask_policy));
+        combine(hash<string>{}(entry_key.rendering));
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry key.
+     *
+     * Post-Conditions:
+     *      Returns the shard responsible for the key.
+     */
+    QrCache::Shard& QrCache::getShard(const EntryKey& key) {
+        /* The low bits also index the shard's map, so mix in the high bits */
+        const size_t value{EntryHash{}(key)};
+
+        return shards[(value ^ (value >> (4 * sizeof(size_t)))) % shards.size()];
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry key.
+     *
+     * Post-Conditions:
+     *      Returns a copy of the entry & marks it as most recently used,
+     *      otherwise returns an entry without a symbol & bytes.
+     */
+    QrCache::Entry QrCache::find(const EntryKey& key) {
+        Shard& shard{getShard(key)};
+        lock_guard lock{shard.mutex};
+
+        const auto it{shard.index.find(key)};
+
+        if (it == shard.index.end()) {
+            return Entry{key, nullptr, nullptr, 0};
+        }
+
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+
+        return *it->second;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Complete entry.
+     *
+     * Post-Conditions:
+     *      Inserts the entry, evicting the least recently used entries
+     *      of its shard until it fits.
+     *      Entries larger than the shard budget are not cached.
+     */
+    void QrCache::insert(Entry entry) {
+        if (entry.cost > shard_budget) {
+            return;
+        }
+
+        Shard& shard{getShard(entry.key)};
+        lock_guard lock{shard.mutex};
+
+        /* Another thread inserted the same key in the meantime */
+        if (shard.index.contains(entry.key)) {
+            return;
+        }
+
+        while (shard.usage + entry.cost > shard_budget) {
+            const Entry& last{shard.entries.back()};
+
+            shard.usage -= last.cost;
+            shard.index.erase(last.key);
+            shard.entries.pop_back();
+            evictions++;
+        }
+
+        shard.usage += entry.cost;
+        shard.entries.push_front(move(entry));
+        shard.index.emplace(shard.entries.front().key, shard.entries.begin());
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Entry key.
+     *
+     * Post-Conditions:
+     *      Returns the approximate memory used by an entry & its key,
+     *      the key is stored in both the list & the index.
+     */
+    size_t QrCache::getCost(const EntryKey& key) {
+        const size_t payload{holds_alternative<wstring>(key.key.data)
+                             ? std::get<wstring>(key.key.data).size() * sizeof(wchar_t)
+                             : std::get<string>(key.key.data).size()};
+
+        return sizeof(Entry) + sizeof(EntryKey) + 2 * (payload + key.rendering.size());
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Generated QR code.
+     *
+     * Post-Conditions:
+     *      Returns the approximate memory used by the QR code,
+     *      the matrix is counted twice to account for the retained pipeline layers.
+     */
+    size_t QrCache::getCost(const QrCode& symbol) {
+        const size_t side{static_cast<size_t>(symbol.isMicro() ? 9 + 2 * symbol.getVersion()
+                                                               : 17 + 4 * symbol.getVersion())};
+
+        return sizeof(QrCode) + 2 * side * (sizeof(vector<bool>) + (side + 7) / 8);
+    }
+}
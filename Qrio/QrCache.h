@@ -0,0 +1,308 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_QRCACHE_H
+#define QR_IO_QRCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "Designator.h"
+#include "Ecl.h"
+#include "MaskPolicy.h"
+#include "QrCode.h"
+
+
+namespace Qrio {
+    /*
+     * QrCache: 1.0
+     *
+     * Thread-safe least recently used cache of finished QR codes,
+     * & optionally of their rendered bytes, within a memory budget.
+     * The cache is split into shards, each guarded by its own mutex,
+     * so that concurrent lookups of different keys rarely contend.
+     * A hit skips the whole encoding pipeline.
+     */
+    class QrCache final {
+    public:
+        /* Default number of shards */
+        const static size_t DEFAULT_SHARDS{16};
+
+        /*
+         * Payload & options of a QR code,
+         * mirrors the arguments of the QrCode constructor.
+         */
+        class Key final {
+        public:
+            /* Data string */
+            std::variant<std::wstring, std::string> data;
+
+            /* Error correction level */
+            Ecl ecl;
+
+            /* Override mode */
+            Designator override_mode;
+
+            /* Preferred version, -1 for auto */
+            int version;
+
+            /* Mask, -1 for auto */
+            int mask;
+
+            /* FNC1 mode */
+            int fnc1;
+
+            /* Structured append ID & count */
+            int struct_id;
+            int struct_count;
+
+            /* Mask selection policy */
+            MaskPolicy mask_policy;
+
+            /*
+             * Pre-Conditions:
+             *      Same arguments as the QrCode constructor.
+             *
+             * Post-Conditions:
+             *      Stores the given payload & options.
+             */
+            explicit Key(std::variant<std::wstring, std::string>,
+                         Ecl ecl = Ecl::L,
+                         Designator override_mode = Designator::TERMINATOR,
+                         int version = -1,
+                         int mask = -1,
+                         int fnc1 = 0,
+                         int struct_id = -1,
+                         int struct_count = -1,
+                         MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+            [[nodiscard]] bool operator==(const Key&) const = default;
+        };
+
+        /*
+         * Pre-Conditions:
+         *      Memory budget in bytes shared by all shards,
+         *      optional number of shards (must be positive).
+         *
+         * Post-Conditions:
+         *      Creates an empty cache.
+         *      Throws an invalid argument exception if the number of shards is 0.
+         */
+        explicit QrCache(size_t, size_t shard_count = DEFAULT_SHARDS);
+
+        QrCache(const QrCache&) = delete;
+
+        QrCache& operator=(const QrCache&) = delete;
+
+        /*
+         * Pre-Conditions:
+         *      Key of the QR code.
+         *
+         * Post-Conditions:
+         *      Returns the cached QR code,
+         *      otherwise generates & caches it (if it fits in its shard).
+         *      Generation errors are propagated & nothing is cached.
+         */
+        [[nodiscard]] std::shared_ptr<const QrCode> get(const Key&);
+
+        /*
+         * Pre-Conditions:
+         *      Key of the QR code,
+         *      name of the rendering (format & options, e.g. "png:scale=4"),
+         *      function rendering a QR code into bytes.
+         *
+         * Post-Conditions:
+         *      Returns the cached bytes of the rendering,
+         *      otherwise renders the (possibly cached) QR code & caches the bytes.
+         */
+        [[nodiscard]] std::shared_ptr<const std::vector<uint8_t>> getRendered(
+                const Key&,
+                const std::string&,
+                const std::function<std::vector<uint8_t>(const QrCode&)>&);
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of lookups served from the cache.
+         */
+        [[nodiscard]] size_t getHits() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of lookups that required generation.
+         */
+        [[nodiscard]] size_t getMisses() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of entries evicted to respect the budget.
+         */
+        [[nodiscard]] size_t getEvictions() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the approximate memory used by the cached entries in bytes.
+         */
+        [[nodiscard]] size_t getMemoryUsage() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of cached entries.
+         */
+        [[nodiscard]] size_t size() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Removes all entries, the counters are kept.
+         */
+        void clear();
+    private:
+        /* Key of an entry, the rendering name is empty for QR codes */
+        class EntryKey final {
+        public:
+            Key key;
+
+            std::string rendering;
+
+            [[nodiscard]] bool operator==(const EntryKey&) const = default;
+        };
+
+        /* Hash of an entry key */
+        class EntryHash final {
+        public:
+            [[nodiscard]] size_t operator()(const EntryKey&) const;
+        };
+
+        /* Cached QR code or rendered bytes */
+        class Entry final {
+        public:
+            EntryKey key;
+
+            std::shared_ptr<const QrCode> symbol;
+
+            std::shared_ptr<const std::vector<uint8_t>> bytes;
+
+            /* Approximate memory used by the entry */
+            size_t cost;
+        };
+
+        /* Independent LRU list, the front is the most recently used */
+        class Shard final {
+        public:
+            mutable std::mutex mutex;
+
+            std::list<Entry> entries;
+
+            std::unordered_map<EntryKey, std::list<Entry>::iterator, EntryHash> index;
+
+            size_t usage{0};
+        };
+
+        /* Memory budget of each shard */
+        const size_t shard_budget;
+
+        std::vector<Shard> shards;
+
+        std::atomic<size_t> hits{0};
+
+        std::atomic<size_t> misses{0};
+
+        std::atomic<size_t> evictions{0};
+
+        /*
+         * Pre-Conditions:
+         *      Entry key.
+         *
+         * Post-Conditions:
+         *      Returns the shard responsible for the key.
+         */
+        [[nodiscard]] Shard& getShard(const EntryKey&);
+
+        /*
+         * Pre-Conditions:
+         *      Entry key.
+         *
+         * Post-Conditions:
+         *      Returns a copy of the entry & marks it as most recently used,
+         *      otherwise returns an entry without a symbol & bytes.
+         */
+        [[nodiscard]] Entry find(const EntryKey&);
+
+        /*
+         * Pre-Conditions:
+         *      Complete entry.
+         *
+         * Post-Conditions:
+         *      Inserts the entry, evicting the least recently used entries
+         *      of its shard until it fits.
+         *      Entries larger than the shard budget are not cached.
+         */
+        void insert(Entry);
+
+        /*
+         * Pre-Conditions:
+         *      Entry key.
+         *
+         * Post-Conditions:
+         *      Returns the approximate memory used by an entry & its key.
+         */
+        [[nodiscard]] static size_t getCost(const EntryKey&);
+
+        /*
+         * Pre-Conditions:
+         *      Generated QR code.
+         *
+         * Post-Conditions:
+         *      Returns the approximate memory used by the QR code.
+         */
+        [[nodiscard]] static size_t getCost(const QrCode&);
+    };
+}
+
+
+#endif //QR_IO_QRCACHE_H
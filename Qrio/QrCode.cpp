@@ -21,67 +21,363 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <ostream>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
-#include "opencv2/opencv.hpp"
+#include "BitmapWriter.h"
+#include "MatrixDiff.h"
+#include "PrinterWriter.h"
+#include "Profiler.h"
 #include "QrCode.h"
+#include "VectorWriter.h"
 
 
 namespace Qrio {
     using std::string, std::wstring, std::variant,
     std::move, std::min, std::length_error, std::holds_alternative,
     std::get, std::unordered_map, std::invalid_argument, std::stoi,
-    std::to_string, std::vector;
-    using cv::imwrite, cv::rectangle, cv::FILLED,
-            cv::Mat, cv::Rect, cv::Scalar;
+    std::to_string, std::vector, std::function, std::domain_error,
+    std::async, std::future, std::launch, std::memcpy, std::ostream,
+    std::ofstream, std::ios, std::transform, std::tolower;
 
     /*
      * Pre-Conditions:
      *      File name to save the QR code image at,
      *      optional scale in pixels (default 10px),
      *      optional border_width (default 4X, Check 6.3.8),
-     *      optional BGR light_color (default white),
-     *      optional BGR dark_color (default black).
+     *      optional light_color (default white),
+     *      optional dark_color (default black).
      *
      * Post-Conditions:
      *      Saves the QR code as an image under the given file name,
      *      in the local directory or the directory specified in the file name.
+     *      The format is determined by the extension (PNG, BMP, PBM, PPM, TIFF, SVG, EPS, PDF,
+     *      ESC/POS, ZPL, or PCL),
+     *      PNG, BMP, PBM, & TIFF files are written with 1 bit per pixel, PBM ignores the colors.
+     *      PNG & TIFF files are streamed, their memory use does not grow with the scale.
+     *      Throws an invalid argument exception for other extensions
+     *      (JPEG is saved by the OpenCvAdapter), invalid options,
+     *      or if the file cannot be created, & a domain error if it cannot be written.
      */
     void QrCode::save(const string& filename,
                       int scale,
                       int border_width,
-                      const Scalar& light_color,
-                      const Scalar& dark_color) const {
-        const int S{static_cast<int>(matrix.size())};
+                      const Color& light_color,
+                      const Color& dark_color) const {
+        const ImageFormat format{getFormat(filename)};
+        const RenderOptions options{.scale = scale, .border_width = border_width,
+                                    .light_color = light_color, .dark_color = dark_color};
 
-        /* Calculate the side of the output image (including the border on all four sides) */
-        const int N{(S + 2 * border_width) * scale};
+        if (format == ImageFormat::JPEG) {
+            throw invalid_argument("JPEG images are saved by the OpenCvAdapter");
+        }
 
-        /* Create an image to store the matrix data with border */
-        Mat image(N, N, CV_8UC3, light_color);
+        /* Checked before the file is created */
+        checkOptions(options);
 
-        /* Draw the squares */
-        for (int i{0}; i < N; i++) {
-            for (int j{0}; j < N; j++) {
-                Rect rect((j + border_width) * scale,
-                              (i + border_width) * scale,
-                              scale,
-                              scale);
-
-                if (i < S and j < S and matrix.at(i, j)) {
-                    rectangle(image, rect, dark_color, FILLED);
-                } else {
-                    rectangle(image, rect, light_color, FILLED);
-                }
-            }
+        /* Save the image to the specified filename */
+        ofstream file{filename, ios::binary};
+
+        if (not file) {
+            throw invalid_argument("Cannot create image file: " + filename);
         }
 
-        /* Save the image to the specified filename */
-        imwrite(filename, image);
+        render(file, format, options);
+        file.close();
+
+        if (not file) {
+            throw domain_error("Image file could not be written: " + filename);
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      File name.
+     *
+     * Post-Conditions:
+     *      Returns the image format matching the extension of the file name (case insensitive).
+     *      Throws an invalid argument exception for unknown extensions.
+     */
+    ImageFormat QrCode::getFormat(const string& filename) {
+        const static unordered_map<string, ImageFormat> EXTENSIONS{
+            {".png", ImageFormat::PNG}, {".bmp", ImageFormat::BMP},
+            {".pbm", ImageFormat::PBM}, {".ppm", ImageFormat::PPM},
+            {".tif", ImageFormat::TIFF}, {".tiff", ImageFormat::TIFF},
+            {".jpg", ImageFormat::JPEG}, {".jpeg", ImageFormat::JPEG},
+            {".svg", ImageFormat::SVG}, {".eps", ImageFormat::EPS},
+            {".pdf", ImageFormat::PDF}, {".escpos", ImageFormat::ESC_POS},
+            {".zpl", ImageFormat::ZPL}, {".pcl", ImageFormat::PCL},
+        };
+
+        string extension{filename.substr(min(filename.rfind('.'), filename.size()))};
+
+        transform(extension.begin(), extension.end(), extension.begin(), [](char c) {
+            return static_cast<char>(tolower(static_cast<unsigned char>(c)));
+        });
+
+        const auto it{EXTENSIONS.find(extension)};
+
+        if (it == EXTENSIONS.end()) {
+            throw invalid_argument("Unknown image extension: " + filename);
+        }
+
+        return it->second;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Render options.
+     *
+     * Post-Conditions:
+     *      Throws an invalid argument exception if the scale is below 1
+     *      or the border width is negative.
+     *      The writers size their images as (size + 2 * border) * scale, so
+     *      other values wrap around or give empty images.
+     */
+    void QrCode::checkOptions(const RenderOptions& options) {
+        if (options.scale < 1) {
+            throw invalid_argument("Render scale must be at least 1");
+        }
+
+        if (options.border_width < 0) {
+            throw invalid_argument("Render border width must not be negative");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Optional image format (default PNG),
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Returns the encoded image bytes, without touching the filesystem.
+     *      Throws a domain error for JPEG, which is rendered by the OpenCvAdapter,
+     *      & an invalid argument exception for invalid options.
+     */
+    vector<uint8_t> QrCode::render(ImageFormat format, const RenderOptions& options) const {
+        QRIO_PROFILE_STAGE(Stage::RENDERING);
+
+        checkOptions(options);
+
+        const uint32_t light{options.light_color.toRgb()}, dark{options.dark_color.toRgb()};
+        string artwork;
+
+        switch (format) {
+            case ImageFormat::PNG:
+                return BitmapWriter::toPng(matrix, options.scale, options.border_width, light, dark,
+                                           options.png_compression, options.png_strategy);
+            case ImageFormat::BMP:
+                return BitmapWriter::toBmp(matrix, options.scale, options.border_width, light, dark);
+            case ImageFormat::PBM:
+                return BitmapWriter::toPbm(matrix, options.scale, options.border_width);
+            case ImageFormat::PPM:
+                return BitmapWriter::toPpm(matrix, options.scale, options.border_width, light, dark);
+            case ImageFormat::TIFF:
+                return BitmapWriter::toTiff(matrix, options.scale, options.border_width, light, dark);
+            case ImageFormat::SVG:
+                artwork = VectorWriter::toSvg(matrix, options.border_width, options.scale, light, dark);
+                break;
+            case ImageFormat::EPS:
+                artwork = VectorWriter::toEps(matrix, options.border_width, options.scale, light, dark);
+                break;
+            case ImageFormat::PDF:
+                artwork = VectorWriter::toPdf(matrix, options.border_width, options.scale, light, dark);
+                break;
+            case ImageFormat::ESC_POS:
+                return PrinterWriter::toEscPos(matrix, options.scale, options.border_width);
+            case ImageFormat::ZPL:
+                artwork = PrinterWriter::toZpl(matrix, options.scale, options.border_width);
+                break;
+            case ImageFormat::PCL:
+                return PrinterWriter::toPcl(matrix, options.scale, options.border_width,
+                                            options.printer_resolution);
+            default:
+                throw domain_error("JPEG images are rendered by the OpenCvAdapter");
+        }
+
+        return {artwork.begin(), artwork.end()};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Output stream (opened in binary mode for files),
+     *      image format,
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Writes the encoded image bytes to the stream.
+     *      PNG & TIFF are streamed one module row at a time, without the whole image in memory.
+     */
+    void QrCode::render(ostream& output, ImageFormat format, const RenderOptions& options) const {
+        QRIO_PROFILE_STAGE(Stage::RENDERING);
+
+        checkOptions(options);
+
+        const uint32_t light{options.light_color.toRgb()}, dark{options.dark_color.toRgb()};
+
+        switch (format) {
+            case ImageFormat::PNG:
+                BitmapWriter::writePng(output, matrix, options.scale, options.border_width, light, dark,
+                                       options.png_compression, options.png_strategy);
+                return;
+            case ImageFormat::TIFF:
+                BitmapWriter::writeTiff(output, matrix, options.scale, options.border_width, light, dark);
+                return;
+            default:
+                break;
+        }
+
+        const vector<uint8_t> bytes{render(format, options)};
+
+        output.write(reinterpret_cast<const char*>(bytes.data()),
+                     static_cast<std::streamsize>(bytes.size()));
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Caller supplied buffer,
+     *      capacity of the buffer in bytes,
+     *      image format,
+     *      optional render options.
+     *
+     * Post-Conditions:
+     *      Writes the encoded image bytes to the buffer & returns their count.
+     *      Throws a length error if the buffer is too small, its contents are then unspecified.
+     */
+    size_t QrCode::render(uint8_t* buffer, size_t capacity, ImageFormat format,
+                          const RenderOptions& options) const {
+        const vector<uint8_t> bytes{render(format, options)};
+
+        if (bytes.size() > capacity) {
+            throw length_error("Buffer too small for the image, "
+                               + to_string(bytes.size()) + " bytes are required");
+        }
+
+        memcpy(buffer, bytes.data(), bytes.size());
+
+        return bytes.size();
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Top left pixel of the destination region,
+     *      bytes between the starts of consecutive rows of the destination,
+     *      width & height of the region in pixels,
+     *      bytes per pixel (1 for gray, 3 for BGR, or 4 for BGRA),
+     *      optional render options (scale, border, & colors).
+     *
+     * Post-Conditions:
+     *      Draws the QR code directly at the top left of the region, in its pixel format.
+     *      Pixels of the region outside of the QR code are left untouched.
+     *      Throws an invalid argument exception if the pixel format is unsupported,
+     *      the options are invalid, or the QR code does not fit in the region.
+     */
+    void QrCode::renderInto(uint8_t* pixels, size_t stride, int width, int height, size_t channels,
+                            const RenderOptions& options) const {
+        QRIO_PROFILE_STAGE(Stage::RENDERING);
+
+        checkOptions(options);
+
+        BitmapWriter::renderInto(matrix, pixels, stride, width, height, channels,
+                                 options.scale, options.border_width,
+                                 options.light_color.toRgb(), options.dark_color.toRgb());
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Previous QR code of the same version,
+     *      optional render options (scale & border),
+     *      optional number of unchanged modules bridged within a row (default 0).
+     *
+     * Post-Conditions:
+     *      Returns the pixel rectangles to redraw on a display showing the previous
+     *      QR code to show this one, empty if they are equal.
+     *      Throws an invalid argument exception if the versions differ or the options are invalid.
+     */
+    vector<DirtyRegion> QrCode::getDirtyRegions(const QrCode& previous, const RenderOptions& options,
+                                                int gap) const {
+        if (previous.getVersion() != getVersion() or previous.isMicro() != isMicro()) {
+            throw invalid_argument("Dirty regions need QR codes of the same version");
+        }
+
+        checkOptions(options);
+
+        vector<DirtyRegion> result{MatrixDiff::getRegions(previous.matrix, matrix, gap)};
+
+        for (DirtyRegion& region: result) {
+            region.x = (region.x + options.border_width) * options.scale;
+            region.y = (region.y + options.border_width) * options.scale;
+            region.width *= options.scale;
+            region.height *= options.scale;
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Previous QR code (not Micro),
+     *      data string,
+     *      optional mask policy.
+     *
+     * Post-Conditions:
+     *      Generates a QR code at the version & ECL of the previous one, whose mask is
+     *      the one changing the fewest modules among the masks near the best penalty,
+     *      so displays refresh smaller regions (Check getDirtyRegions).
+     *      Throws an invalid argument exception for Micro QR codes,
+     *      & a length error if the data does not fit the version.
+     */
+    QrCode QrCode::fromPrevious(const QrCode& previous, const variant<wstring, string>& data,
+                                MaskPolicy mask_policy) {
+        if (previous.isMicro()) {
+            throw invalid_argument("Micro QR codes cannot follow a previous symbol");
+        }
+
+        const Ecl ecl{previous.getEcl()};
+
+        return QrCode{Structurer{ErrorCorrectionEncoder{Encoder{
+            DataAnalyzer{processedData(data),
+                         getVersion(data, ecl, previous.getVersion(), Designator::TERMINATOR),
+                         ecl, Designator::TERMINATOR, getEci(data)}}},
+                                 -1, mask_policy, &previous.matrix}};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the row major module matrix, true for dark modules.
+     */
+    const SquareMatrix& QrCode::getMatrix() const {
+        return matrix;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the wall time & allocations of each stage of the construction,
+     *      empty unless built with QRIO_PROFILING (Check Profiler).
+     */
+    StageProfile QrCode::getProfile() const {
+#ifdef QRIO_PROFILING
+        return profile;
+#else
+        return {};
+#endif
     }
 
     /*
@@ -109,18 +405,58 @@ namespace Qrio {
      *
      *      optional structured append count of the given QR (number of linked QRs),
      *
-     *      optional mask to specify the mask of the QR (-1 for auto).
+     *      optional mask to specify the mask of the QR (-1 for auto),
+     *
+     *      optional mask policy used when the mask is automatic.
      *
      * Post-Conditions:
      *      Performs the necessary operations on the data to generate a QR boolean matrix,
      *      where a 0 indicates a light square and a 1 indicates a dark square.
      */
     QrCode::QrCode(const variant<wstring, string>& data, Ecl ecl, Designator override_mode,
-                   int version, int mask, int fnc1, int struct_id, int struct_count):
+                   int version, int mask, int fnc1, int struct_id, int struct_count,
+                   MaskPolicy mask_policy):
+#ifdef QRIO_PROFILING
+                   profile{Profiler::begin()},
+#endif
                    matrix{ErrorCorrectionEncoder(Encoder(
                            DataAnalyzer(processedData(data), getVersion(data, ecl, version, override_mode),
                                         ecl, override_mode, getEci(data),
-                                        fnc1, struct_id, struct_count))), mask} {}
+                                        fnc1, struct_id, struct_count))), mask, mask_policy} {
+#ifdef QRIO_PROFILING
+        profile = Profiler::take();
+#endif
+    }
+
+    /*
+     * Pre-Conditions:
+     *      List of (mode, text) segments, ECI entries are placed
+     *      before the segment they apply to,
+     *      optional ECL,
+     *      optional version (-1 for auto),
+     *      optional mask (-1 for auto),
+     *      optional fnc1,
+     *      optional structured append ID & count,
+     *      optional mask policy.
+     *
+     * Post-Conditions:
+     *      Encodes the segments exactly as given, bypassing the data analysis,
+     *      into a QR boolean matrix.
+     */
+    QrCode::QrCode(const SegmentList& segments, Ecl ecl, int version, int mask,
+                   int fnc1, int struct_id, int struct_count, MaskPolicy mask_policy):
+#ifdef QRIO_PROFILING
+                   profile{Profiler::begin()},
+#endif
+                   matrix{ErrorCorrectionEncoder(Encoder(
+                           DataAnalyzer(segments,
+                                        getVersion(segments, ecl, version,
+                                                   fnc1, struct_id, struct_count),
+                                        ecl, fnc1, struct_id, struct_count))), mask, mask_policy} {
+#ifdef QRIO_PROFILING
+        profile = Profiler::take();
+#endif
+    }
 
     /*
      * Pre-Conditions:
@@ -138,20 +474,73 @@ namespace Qrio {
                            Ecl ecl,
                            int preferred_version,
                            Designator mode) {
-        /* Minimum & maximum possible versions, based on the standard */
-        const static int MIN_VERSION{DataAnalyzer::MIN_VERSION},
-                            MAX_VERSION{DataAnalyzer::MAX_VERSION};
+        return findVersion(preferred_version, [&](int version) {
+            return testVersion(data, ecl, version, mode);
+        });
+    }
+
+    /*
+     * Pre-Conditions:
+     *      List of segments,
+     *      ECL,
+     *      Preferred version to be used,
+     *      fnc1 mode,
+     *      structured append ID & count.
+     *
+     * Post-Conditions:
+     *      Returns the preferred version if it can store the segments,
+     *      otherwise if it is not specified (or invalid), an appropriate
+     *      version is determined.
+     *      If no version can store the segments, a length exception is thrown.
+     */
+    int QrCode::getVersion(const SegmentList& segments,
+                           Ecl ecl,
+                           int preferred_version,
+                           int fnc1,
+                           int struct_id,
+                           int struct_count) {
+        return findVersion(preferred_version, [&](int version) {
+            /* Invalid segments are reported as is, only overflows are caught */
+            try {
+                Encoder encoder{DataAnalyzer{segments, version, ecl,
+                                             fnc1, struct_id, struct_count}};
+                return true;
+            } catch (const domain_error&) {
+                return false;
+            }
+        });
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Preferred version to be used,
+     *      predicate returning true iff a version fits the data,
+     *      maximum version.
+     *
+     * Post-Conditions:
+     *      Returns the preferred version if it is valid & fits,
+     *      otherwise the smallest fitting version is searched for.
+     *      If no version fits, a length exception is thrown.
+     */
+    int QrCode::findVersion(int preferred_version,
+                            const function<bool(int)>& fits,
+                            int max_version) {
+        QRIO_PROFILE_STAGE(Stage::VERSION_SEARCH);
+
+        /* Minimum possible version, based on the standard */
+        const static int MIN_VERSION{DataAnalyzer::MIN_VERSION};
 
         if (preferred_version < MIN_VERSION
-            or MAX_VERSION < preferred_version) {
+            or max_version < preferred_version) {
             /* Generate a new version */
-            int high{MAX_VERSION}, low{MIN_VERSION},
+            int high{max_version}, low{MIN_VERSION},
                 mid, prev_success{-1};
 
             while (low <= high) {
                 mid = (high + low) / 2;
+                QRIO_PROFILE_PROBE();
 
-                if (testVersion(data, ecl, mid, mode)) {
+                if (fits(mid)) {
                     prev_success = mid;
                     high = mid - 1;
                 } else {
@@ -167,7 +556,9 @@ namespace Qrio {
         }
 
         /* Use preferred version */
-        if (testVersion(data, ecl, preferred_version, mode)) {
+        QRIO_PROFILE_PROBE();
+
+        if (fits(preferred_version)) {
             return preferred_version;
         } else {
             throw length_error("Given preferred version does not fit data");
@@ -212,38 +603,25 @@ namespace Qrio {
      *      invalid_argument exception is thrown.
      */
     wstring QrCode::processedData(const variant<wstring, string>& data) {
-        wstring result{extractWideString(data)};
-        wstring result_cpy{result};
-        const auto N{result_cpy.size()};
-
-        const auto throw_exc{[](size_t index) {
-            throw invalid_argument("\nInvalid ECI symbol at "
-            + to_string(index)
-            + "\n");
-        }};
-
-        for (size_t i{0}; i < N; i++) {
-            if (result_cpy[i] == 0x5C) {
-                if (i == N - 2) {
-                    if (result_cpy[i + 1] == 0x5C) {
-                        break;
-                    } else {
-                        throw_exc(i);
-                    }
-                }
-
-                if (result_cpy[i + 1] == 0x5C) {
-                    continue;
-                }
+        QRIO_PROFILE_STAGE(Stage::ESCAPES);
 
-                try {
-                    stoi(result_cpy.substr(i + 1, 6));
-                } catch (...) {
-                    throw_exc(i);
-                }
+        const wstring raw{extractWideString(data)};
+        const auto N{raw.size()};
+        wstring result{};
 
-                result.erase(i, 7);
-                i += 7;
+        for (size_t i{0}; i < N; i++) {
+            if (raw[i] != 0x5C) {
+                result += raw[i];
+            } else if (i + 1 < N and raw[i + 1] == 0x5C) {
+                /* Doubled 0x5C represents a single one */
+                result += raw[++i];
+            } else if (i + 6 < N and DataAnalyzer::isNumeric(raw.substr(i + 1, 6))) {
+                /* Skip the ECI escape sequence */
+                i += 6;
+            } else {
+                throw invalid_argument("\nInvalid ECI symbol at "
+                                       + to_string(i)
+                                       + "\n");
             }
         }
 
@@ -283,6 +661,18 @@ namespace Qrio {
         return matrix.ec_encoder.encoder.analyzer.getEcl();
     }
 
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns true if the QR code is a Micro QR code,
+     *      its version then refers to M1 to M4.
+     */
+    bool QrCode::isMicro() const {
+        return matrix.ec_encoder.encoder.analyzer.isMicro();
+    }
+
     /*
      * Pre-Conditions:
      *      Data string.
@@ -292,14 +682,24 @@ namespace Qrio {
      */
     unordered_map<size_t, int> QrCode::getEci(
             const variant<wstring, string>& crude_data) {
+        QRIO_PROFILE_STAGE(Stage::ESCAPES);
+
         const auto& data{extractWideString(crude_data)};
         const auto N{data.size()};
 
         unordered_map<size_t, int> result{};
 
-        for (size_t i{0}; i < N - 6; i++) {
-            if (data[i] == 0x5C and data[i + 1] != 0x5C) {
-                result[i] = stoi(data.substr(i + 1, 6));
+        /* Keys are indices in the processed data string */
+        for (size_t i{0}, index{0}; i < N; i++, index++) {
+            if (data[i] != 0x5C) {
+                continue;
+            }
+
+            if (i + 1 < N and data[i + 1] == 0x5C) {
+                i++;
+            } else if (i + 6 < N) {
+                result[index--] = stoi(data.substr(i + 1, 6));
+                i += 6;
             }
         }
 
@@ -327,39 +727,419 @@ namespace Qrio {
      *      Vector of data QR codes,
      *      ECL for all the QR codes,
      *      version for all the QR codes,
-     *      mask for all the QR codes.
+     *      mask for all the QR codes,
+     *      mask policy for all the QR codes.
      *
      * Post-Conditions:
      *      Generates QR codes for the given data strings.
+     *      The parity is computed over the whole message &
+     *      the QR codes are generated in parallel.
      */
     vector<QrCode> QrCode::makeStructured(const vector<wstring>& data,
                                           Ecl ecl,
                                           Designator override_mode,
                                           int version,
                                           int mask,
-                                          int fnc1) {
-        if (data.empty() or 16 < data.size()) {
+                                          int fnc1,
+                                          MaskPolicy mask_policy) {
+        if (data.empty() or static_cast<size_t>(MAX_STRUCTURED) < data.size()) {
             throw invalid_argument(
                     "Structured append requires at least 1 data string and at most 16\n"
                     );
         }
 
         const int N{static_cast<int>(data.size())};
-        vector<QrCode> result;
+        wstring message{};
+
+        for (const auto& part: data) {
+            message += processedData(part);
+        }
+
+        const int parity{Encoder::getParity(message)};
+        vector<future<QrCode>> parts;
 
         for (int i{0}; i < N; i++) {
-            result.emplace_back(
-                    QrCode(data[i],
-                           ecl,
-                           override_mode,
-                           version,
-                           mask,
-                           fnc1,
-                           i,
-                           N)
-                    );
+            parts.push_back(async(launch::async, [&, i]() {
+                return makePart(data[i], ecl, override_mode,
+                                version, mask, fnc1, i, N, parity, mask_policy);
+            }));
+        }
+
+        vector<QrCode> result;
+
+        for (auto& part: parts) {
+            result.push_back(part.get());
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string of the whole message (0x5C values must be doubled),
+     *      ECL for all the QR codes,
+     *      maximum version for all the QR codes,
+     *      encoding method for all QR codes,
+     *      mask for all the QR codes,
+     *      fnc1 mode for all QR codes,
+     *      mask policy for all QR codes.
+     *
+     * Post-Conditions:
+     *      Splits the data into the least number of structured append
+     *      QR codes (at most 16) that do not exceed the maximum version,
+     *      then shrinks the version of the parts as far as the number of
+     *      QR codes allows (Check splitData).
+     *      The parts are generated in parallel.
+     *      If the data does not fit in 16 QR codes, a length exception is thrown.
+     */
+    vector<QrCode> QrCode::splitStructured(const variant<wstring, string>& data,
+                                           Ecl ecl,
+                                           int max_version,
+                                           Designator override_mode,
+                                           int mask,
+                                           int fnc1,
+                                           MaskPolicy mask_policy) {
+        return makeStructured(splitData(data, ecl, max_version, override_mode, fnc1),
+                              ecl, override_mode, -1, mask, fnc1, mask_policy);
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string of the whole message (0x5C values must be doubled),
+     *      ECL for all the QR codes,
+     *      maximum version for all the QR codes,
+     *      encoding method for all QR codes,
+     *      fnc1 mode for all QR codes.
+     *
+     * Post-Conditions:
+     *      Returns the data strings of the least number of structured append
+     *      QR codes (at most 16) that do not exceed the maximum version,
+     *      cut so the version of the parts is as small as the number of QR codes allows.
+     *      Escape sequences are never broken, & every part after the first starts
+     *      with the ECI escape in effect at its start, so it decodes with the same charset.
+     *      If the data does not fit in 16 QR codes, a length exception is thrown.
+     */
+    vector<wstring> QrCode::splitData(const variant<wstring, string>& data,
+                                      Ecl ecl,
+                                      int max_version,
+                                      Designator override_mode,
+                                      int fnc1) {
+        if (max_version < DataAnalyzer::MIN_VERSION
+            or DataAnalyzer::MAX_VERSION < max_version) {
+            throw domain_error("Maximum version out of bounds [1, 40]");
+        }
+
+        const wstring raw{extractWideString(data)};
+
+        if (raw.empty()) {
+            throw invalid_argument("Structured append requires non-empty data\n");
+        }
+
+        /* Computed once over the whole message, shared by all the parts */
+        const int parity{Encoder::getParity(processedData(raw))};
+        const auto cuts{getCutPositions(raw)};
+
+        /* ECI escape in effect at each cut, escapes are the only 7 character pieces */
+        vector<wstring> active(cuts.size());
+
+        for (size_t i{1}; i < cuts.size(); i++) {
+            active[i] = cuts[i] - cuts[i - 1] == 7 ? raw.substr(cuts[i - 1], 7) : active[i - 1];
+        }
+
+        /* Data of the part between two cuts, the ECI is not repeated if the part starts with one */
+        const auto getPart{[&](size_t first, size_t last) {
+            const bool has_eci{cuts[first + 1] - cuts[first] == 7};
+
+            return (has_eci ? wstring{} : active[first]) + raw.substr(cuts[first], cuts[last] - cuts[first]);
+        }};
+
+        /*
+         * Greedily takes the longest prefix that fits the version.
+         * Returns the indices of the split points in cuts,
+         * or nothing if the data needs more than 16 QR codes.
+         */
+        const auto split{[&](int version) {
+            vector<size_t> bounds{0};
+            size_t current{0}, low, high, mid, best;
+
+            while (current < cuts.size() - 1) {
+                if (static_cast<size_t>(MAX_STRUCTURED) < bounds.size()) {
+                    return vector<size_t>{};
+                }
+
+                low = current + 1;
+                high = cuts.size() - 1;
+                best = current;
+
+                while (low <= high) {
+                    mid = (low + high) / 2;
+
+                    if (testPart(getPart(current, mid), ecl, version, override_mode, fnc1, parity)) {
+                        best = mid;
+                        low = mid + 1;
+                    } else {
+                        high = mid - 1;
+                    }
+                }
+
+                /* Not even a single character fits */
+                if (best == current) {
+                    return vector<size_t>{};
+                }
+
+                bounds.push_back(best);
+                current = best;
+            }
+
+            return bounds;
+        }};
+
+        auto bounds{split(max_version)};
+
+        if (bounds.empty()) {
+            throw length_error("Data too long for structured append");
+        }
+
+        /* Smallest version that does not require more QR codes */
+        int low{DataAnalyzer::MIN_VERSION}, high{max_version - 1}, mid;
+
+        while (low <= high) {
+            mid = (low + high) / 2;
+            auto candidate{split(mid)};
+
+            if (not candidate.empty() and candidate.size() <= bounds.size()) {
+                bounds = move(candidate);
+                high = mid - 1;
+            } else {
+                low = mid + 1;
+            }
+        }
+
+        vector<wstring> result{};
+
+        for (size_t i{0}; i + 1 < bounds.size(); i++) {
+            result.push_back(getPart(bounds[i], bounds[i + 1]));
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Unicode string (used as is),
+     *      optional ECL,
+     *      optional version (-1 for auto),
+     *      optional mask (-1 for auto),
+     *      optional mask policy.
+     *
+     * Post-Conditions:
+     *      Generates a QR code where the characters that exist in Shift JIS
+     *      are encoded in Kanji mode (13 bits per character).
+     *      Any other character beyond Latin-1 is encoded in UTF-8 under ECI 26.
+     */
+    QrCode QrCode::fromUnicode(const wstring& text,
+                               Ecl ecl,
+                               int version,
+                               int mask,
+                               MaskPolicy mask_policy) {
+        unordered_map<size_t, int> eci{};
+        const wstring data{DataAnalyzer::fromUnicode(text, eci)};
+
+        const int fitting_version{findVersion(version, [&](int candidate) {
+            try {
+                Encoder encoder{DataAnalyzer{data, candidate, ecl,
+                                             Designator::TERMINATOR, eci}};
+
+                return true;
+            } catch (const domain_error&) {
+                return false;
+            }
+        })};
+
+        return QrCode{Structurer{ErrorCorrectionEncoder{Encoder{
+            DataAnalyzer{data, fitting_version, ecl, Designator::TERMINATOR, eci}}},
+                                 mask, mask_policy}};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      GS1 element string, bracketed "(01)09501101530003(10)AB-123"
+     *      or raw with 0x1D after non-final variable length values,
+     *      optional ECL,
+     *      optional version (-1 for auto),
+     *      optional mask (-1 for auto),
+     *      optional mask policy.
+     *
+     * Post-Conditions:
+     *      Generates a GS1 QR code (FNC1 in the first position),
+     *      where the element string is segmented for the least number of bits
+     *      in the chosen version.
+     */
+    QrCode QrCode::makeGs1(const wstring& text,
+                           Ecl ecl,
+                           int version,
+                           int mask,
+                           MaskPolicy mask_policy) {
+        /* FNC1 in the first position, Check 7.4.8.2 */
+        const static int FNC1_FIRST{1};
+
+        const Gs1 gs1{text};
+
+        const int fitting_version{findVersion(version, [&](int candidate) {
+            try {
+                Encoder encoder{DataAnalyzer{gs1.getSegments(candidate), candidate,
+                                             ecl, FNC1_FIRST}};
+
+                return true;
+            } catch (const domain_error&) {
+                return false;
+            }
+        })};
+
+        return QrCode{Structurer{ErrorCorrectionEncoder{Encoder{
+            DataAnalyzer{gs1.getSegments(fitting_version), fitting_version,
+                         ecl, FNC1_FIRST}}},
+                                 mask, mask_policy}};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string (0x5C values must be doubled, ECI is not supported),
+     *      optional ECL,
+     *      optional override mode,
+     *      optional version in [1, 4] (-1 for auto),
+     *      optional mask in [0, 3] (-1 for auto).
+     *
+     * Post-Conditions:
+     *      Generates a Micro QR code, which has a single finder pattern
+     *      & requires a quiet zone of only 2X (Check 6.3.8).
+     */
+    QrCode QrCode::makeMicro(const variant<wstring, string>& data,
+                             Ecl ecl,
+                             Designator override_mode,
+                             int version,
+                             int mask) {
+        if (not getEci(data).empty()) {
+            throw invalid_argument("Micro QR codes do not support ECI");
+        }
+
+        if (ecl == Ecl::H) {
+            throw invalid_argument("Micro QR codes do not support Ecl::H");
+        }
+
+        const wstring processed{processedData(data)};
+
+        const int fitting_version{findVersion(version, [&](int candidate) {
+            try {
+                Encoder encoder{DataAnalyzer{processed, candidate, ecl, override_mode,
+                                             {}, 0, -1, -1, -1, true}};
+
+                return true;
+            } catch (const domain_error&) {
+                return false;
+            }
+        }, DataAnalyzer::MAX_MICRO_VERSION)};
+
+        return QrCode{Structurer{ErrorCorrectionEncoder{Encoder{
+            DataAnalyzer{processed, fitting_version, ecl, override_mode,
+                         {}, 0, -1, -1, -1, true}}},
+                                 mask}};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Structured QR matrix.
+     *
+     * Post-Conditions:
+     *      Wraps the given matrix, with the stages recorded on the thread since the last QR code.
+     */
+    QrCode::QrCode(Structurer matrix):
+#ifdef QRIO_PROFILING
+            profile{Profiler::take()},
+#endif
+            matrix{move(matrix)} {}
+
+    /*
+     * Pre-Conditions:
+     *      Data string of one part,
+     *      ECL,
+     *      encoding method,
+     *      preferred version,
+     *      mask,
+     *      fnc1 mode,
+     *      structured append ID, count, & parity of the whole message,
+     *      mask policy.
+     *
+     * Post-Conditions:
+     *      Returns the QR code of the given part of a structured append message.
+     */
+    QrCode QrCode::makePart(const wstring& data, Ecl ecl, Designator override_mode,
+                            int version, int mask, int fnc1,
+                            int struct_id, int struct_count, int struct_parity,
+                            MaskPolicy mask_policy) {
+        const int fitting_version{findVersion(version, [&](int candidate) {
+            return testPart(data, ecl, candidate, override_mode, fnc1, struct_parity);
+        })};
+
+        return QrCode{Structurer{ErrorCorrectionEncoder{Encoder{
+            DataAnalyzer{processedData(data), fitting_version, ecl, override_mode,
+                         getEci(data), fnc1, struct_id, struct_count, struct_parity}}},
+                                 mask, mask_policy}};
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string of one part,
+     *      ECL,
+     *      version to be tested,
+     *      encoding method,
+     *      fnc1 mode,
+     *      parity of the whole message.
+     *
+     * Post-Conditions:
+     *      Returns true if the part fits in a structured append QR code
+     *      of the given version, otherwise false.
+     */
+    bool QrCode::testPart(const wstring& data, Ecl ecl, int version,
+                          Designator mode, int fnc1, int parity) {
+        try {
+            /* The header has the same size for all IDs & counts */
+            DataAnalyzer analyzer{processedData(data), version, ecl, mode,
+                                  getEci(data), fnc1, 0, MAX_STRUCTURED, parity};
+            Encoder encoder{analyzer};
+
+            return true;
+        } catch (...) {
+            return false;
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Data string.
+     *
+     * Post-Conditions:
+     *      Returns the ascending indices at which the data string can be split
+     *      without breaking an escape sequence, including 0 & its size.
+     */
+    vector<size_t> QrCode::getCutPositions(const wstring& data) {
+        const auto N{data.size()};
+        vector<size_t> result{};
+        size_t i{0};
+
+        while (i < N) {
+            result.push_back(i);
+
+            if (data[i] != 0x5C) {
+                i++;
+            } else if (i + 1 < N and data[i + 1] == 0x5C) {
+                i += 2;
+            } else {
+                i += 7;
+            }
         }
 
+        result.push_back(N);
         return result;
     }
 }
@@ -24,18 +24,27 @@
 #ifndef QR_IO_QRCODE_H
 #define QR_IO_QRCODE_H
 
+#include <cstdint>
+#include <functional>
+#include <ostream>
 #include <string>
 #include <unordered_map>
 #include <variant>
 #include <vector>
 
-#include "opencv2/opencv.hpp"
-
+#include "Color.h"
 #include "DataAnalyzer.h"
 #include "Designator.h"
+#include "DirtyRegion.h"
 #include "Ecl.h"
 #include "Encoder.h"
 #include "ErrorCorrectionEncoder.h"
+#include "Gs1.h"
+#include "ImageFormat.h"
+#include "MaskPolicy.h"
+#include "RenderOptions.h"
+#include "SquareMatrix.h"
+#include "StageProfile.h"
 #include "Structurer.h"
 
 
@@ -68,7 +77,10 @@ namespace Qrio {
          *
          *      optional structured append count of the given QR (number of linked QRs),
          *
-         *      optional mask to specify the mask of the QR (-1 for auto).
+         *      optional mask to specify the mask of the QR (-1 for auto),
+         *
+         *      optional mask policy used when the mask is automatic
+         *      (MaskPolicy::FAST estimates the penalties on a sample).
          *
          * Post-Conditions:
          *      Performs the necessary operations on the data to generate a QR boolean matrix,
@@ -81,25 +93,185 @@ namespace Qrio {
                         int mask = -1,
                         int fnc1 = 0,
                         int struct_id = -1,
-                        int struct_count = -1);
+                        int struct_count = -1,
+                        MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+        /*
+         * Pre-Conditions:
+         *      List of (mode, text) segments, ECI entries are placed
+         *      before the segment they apply to
+         *      (texts are used as is, no escape sequences are processed),
+         *
+         *      optional ECL (Error Correction Level) default is Low (Ecl::L),
+         *
+         *      optional version to specify the version of the QR code
+         *      (-1 for auto, a length exception is thrown if the data does not fit),
+         *
+         *      optional mask to specify the mask of the QR (-1 for auto),
+         *
+         *      optional fnc1 (1 indicates the usage of FNC1-1st position,
+         *                      2 indicates the usage of FNC1-2nd position),
+         *
+         *      optional structured append ID of the given QR (must be between 0 and 15),
+         *
+         *      optional structured append count of the given QR (number of linked QRs),
+         *
+         *      optional mask policy used when the mask is automatic.
+         *
+         * Post-Conditions:
+         *      Encodes the segments exactly as given, bypassing the data analysis,
+         *      into a QR boolean matrix.
+         */
+        explicit QrCode(const SegmentList&,
+                        Ecl ecl = Ecl::L,
+                        int version = -1,
+                        int mask = -1,
+                        int fnc1 = 0,
+                        int struct_id = -1,
+                        int struct_count = -1,
+                        MaskPolicy mask_policy = MaskPolicy::EXACT);
 
         /*
          * Pre-Conditions:
          *      File name to save the QR code image at,
          *      optional scale in pixels (default 10px),
          *      optional border_width (default 4X, Check 6.3.8),
-         *      optional RGB light_color (default white),
-         *      optional RGB dark_color (default black).
+         *      optional light_color (default white),
+         *      optional dark_color (default black).
          *
          * Post-Conditions:
          *      Saves the QR code as an image under the given file name,
          *      in the local directory or the directory specified in the file name.
+         *      The format is determined by the extension (PNG, BMP, PBM, PPM, TIFF, SVG, EPS, PDF,
+         *      ESC/POS, ZPL, or PCL),
+         *      PNG, BMP, PBM, & TIFF files are written with 1 bit per pixel, PBM ignores the colors.
+         *      PNG & TIFF files are streamed, their memory use does not grow with the scale.
+         *      Throws an invalid argument exception for other extensions
+         *      (JPEG is saved by the OpenCvAdapter), invalid options (Check checkOptions),
+         *      or if the file cannot be created, & a domain error if it cannot be written.
          */
         void save(const std::string& file_name,
                   int scale = 10,
                   int border_width = 4,
-                  const cv::Scalar& light_color = {255, 255, 255},
-                  const cv::Scalar& dark_color = {0, 0, 0}) const;
+                  const Color& light_color = {255, 255, 255},
+                  const Color& dark_color = {0, 0, 0}) const;
+
+        /*
+         * Pre-Conditions:
+         *      File name.
+         *
+         * Post-Conditions:
+         *      Returns the image format matching the extension of the file name.
+         *      Throws an invalid argument exception for unknown extensions.
+         */
+        [[nodiscard]] static ImageFormat getFormat(const std::string&);
+
+        /*
+         * Pre-Conditions:
+         *      Render options.
+         *
+         * Post-Conditions:
+         *      Throws an invalid argument exception if the scale is below 1
+         *      or the border width is negative, checked by every rendering entry point.
+         */
+        static void checkOptions(const RenderOptions&);
+
+        /*
+         * Pre-Conditions:
+         *      Optional image format (default PNG),
+         *      optional render options (scale, border, colors, PNG compression & strategy).
+         *
+         * Post-Conditions:
+         *      Returns the encoded image bytes, without touching the filesystem.
+         *      Throws a domain error for JPEG, which is rendered by the OpenCvAdapter,
+         *      & an invalid argument exception for invalid options (Check checkOptions).
+         */
+        [[nodiscard]] std::vector<uint8_t> render(ImageFormat format = ImageFormat::PNG,
+                                                  const RenderOptions& options = RenderOptions{}) const;
+
+        /*
+         * Pre-Conditions:
+         *      Output stream (opened in binary mode for files),
+         *      image format,
+         *      optional render options.
+         *
+         * Post-Conditions:
+         *      Writes the encoded image bytes to the stream.
+         *      PNG & TIFF are streamed one module row at a time, without the whole image in memory.
+         *      Throws an invalid argument exception for invalid options (Check checkOptions).
+         */
+        void render(std::ostream&,
+                    ImageFormat format,
+                    const RenderOptions& options = RenderOptions{}) const;
+
+        /*
+         * Pre-Conditions:
+         *      Caller supplied buffer,
+         *      capacity of the buffer in bytes,
+         *      image format,
+         *      optional render options.
+         *
+         * Post-Conditions:
+         *      Writes the encoded image bytes to the buffer & returns their count.
+         *      Throws a length error if the buffer is too small.
+         */
+        size_t render(uint8_t*,
+                      size_t,
+                      ImageFormat format,
+                      const RenderOptions& options = RenderOptions{}) const;
+
+        /*
+         * Pre-Conditions:
+         *      Top left pixel of the destination region,
+         *      bytes between the starts of consecutive rows of the destination,
+         *      width & height of the region in pixels,
+         *      bytes per pixel (1 for gray, 3 for BGR, or 4 for BGRA),
+         *      optional render options (scale, border, & colors).
+         *
+         * Post-Conditions:
+         *      Draws the QR code directly at the top left of the region, in its pixel format.
+         *      Pixels of the region outside of the QR code are left untouched.
+         *      Throws an invalid argument exception if the pixel format is unsupported,
+         *      the options are invalid (Check checkOptions), or the QR code does not fit in the region.
+         */
+        void renderInto(uint8_t*,
+                        size_t,
+                        int,
+                        int,
+                        size_t,
+                        const RenderOptions& options = RenderOptions{}) const;
+
+        /*
+         * Pre-Conditions:
+         *      Previous QR code of the same version,
+         *      optional render options (scale & border),
+         *      optional number of unchanged modules bridged within a row (default 0).
+         *
+         * Post-Conditions:
+         *      Returns the pixel rectangles to redraw on a display showing the previous
+         *      QR code to show this one, empty if they are equal.
+         *      Throws an invalid argument exception if the versions differ or the options are invalid.
+         */
+        [[nodiscard]] std::vector<DirtyRegion> getDirtyRegions(const QrCode&,
+                                                               const RenderOptions& options = RenderOptions{},
+                                                               int gap = 0) const;
+
+        /*
+         * Pre-Conditions:
+         *      Previous QR code (not Micro),
+         *      data string,
+         *      optional mask policy.
+         *
+         * Post-Conditions:
+         *      Generates a QR code at the version & ECL of the previous one, whose mask is
+         *      the one changing the fewest modules among the masks near the best penalty,
+         *      so displays refresh smaller regions (Check getDirtyRegions).
+         *      Throws an invalid argument exception for Micro QR codes,
+         *      & a length error if the data does not fit the version.
+         */
+        [[nodiscard]] static QrCode fromPrevious(const QrCode&,
+                                                 const std::variant<std::wstring, std::string>&,
+                                                 MaskPolicy mask_policy = MaskPolicy::EXACT);
 
         /*
          * Pre-Conditions:
@@ -108,10 +280,13 @@ namespace Qrio {
          *      encoding method for all QR codes,
          *      version for all the QR codes,
          *      mask for all the QR codes,
-         *      fnc1 mode for all QR codes.
+         *      fnc1 mode for all QR codes,
+         *      mask policy for all QR codes.
          *
          * Post-Conditions:
          *      Generates QR codes for the given data strings.
+         *      The parity is computed over the whole message &
+         *      the QR codes are generated in parallel.
          */
         [[nodiscard]] static std::vector<QrCode> makeStructured(
                 const std::vector<std::wstring>&,
@@ -119,8 +294,127 @@ namespace Qrio {
                 Designator override_mode = Designator::TERMINATOR,
                 int version = -1,
                 int mask = -1,
+                int fnc1 = 0,
+                MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+        /*
+         * Pre-Conditions:
+         *      Data string of the whole message (0x5C values must be doubled),
+         *      ECL for all the QR codes,
+         *      maximum version for all the QR codes,
+         *      encoding method for all QR codes,
+         *      mask for all the QR codes,
+         *      fnc1 mode for all QR codes,
+         *      mask policy for all QR codes.
+         *
+         * Post-Conditions:
+         *      Splits the data into the least number of structured append
+         *      QR codes (at most 16) that do not exceed the maximum version,
+         *      then shrinks the version of the parts as far as the number of
+         *      QR codes allows (Check splitData).
+         *      The parts are generated in parallel.
+         *      If the data does not fit in 16 QR codes, a length exception is thrown.
+         */
+        [[nodiscard]] static std::vector<QrCode> splitStructured(
+                const std::variant<std::wstring, std::string>&,
+                Ecl ecl = Ecl::L,
+                int max_version = DataAnalyzer::MAX_VERSION,
+                Designator override_mode = Designator::TERMINATOR,
+                int mask = -1,
+                int fnc1 = 0,
+                MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+        /*
+         * Pre-Conditions:
+         *      Data string of the whole message (0x5C values must be doubled),
+         *      ECL for all the QR codes,
+         *      maximum version for all the QR codes,
+         *      encoding method for all QR codes,
+         *      fnc1 mode for all QR codes.
+         *
+         * Post-Conditions:
+         *      Returns the data strings of the least number of structured append
+         *      QR codes (at most 16) that do not exceed the maximum version,
+         *      cut so the version of the parts is as small as the number of QR codes allows.
+         *      Escape sequences are never broken, & every part after the first starts
+         *      with the ECI escape in effect at its start, so it decodes with the same charset.
+         *      If the data does not fit in 16 QR codes, a length exception is thrown.
+         */
+        [[nodiscard]] static std::vector<std::wstring> splitData(
+                const std::variant<std::wstring, std::string>&,
+                Ecl ecl = Ecl::L,
+                int max_version = DataAnalyzer::MAX_VERSION,
+                Designator override_mode = Designator::TERMINATOR,
                 int fnc1 = 0);
 
+        /*
+         * Pre-Conditions:
+         *      Unicode string (texts are used as is, no escape sequences are processed),
+         *      optional ECL (Error Correction Level) default is Low (Ecl::L),
+         *      optional version (-1 for auto),
+         *      optional mask (-1 for auto),
+         *      optional mask policy used when the mask is automatic.
+         *
+         * Post-Conditions:
+         *      Generates a QR code where the characters that exist in Shift JIS
+         *      are encoded in Kanji mode (13 bits per character).
+         *      Any other character beyond Latin-1 is encoded in UTF-8 under ECI 26.
+         */
+        [[nodiscard]] static QrCode fromUnicode(
+                const std::wstring&,
+                Ecl ecl = Ecl::L,
+                int version = -1,
+                int mask = -1,
+                MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+        /*
+         * Pre-Conditions:
+         *      GS1 element string, bracketed "(01)09501101530003(10)AB-123"
+         *      or raw with 0x1D after non-final variable length values,
+         *      optional ECL (Error Correction Level) default is Low (Ecl::L),
+         *      optional version (-1 for auto),
+         *      optional mask (-1 for auto),
+         *      optional mask policy used when the mask is automatic.
+         *
+         * Post-Conditions:
+         *      Generates a GS1 QR code (FNC1 in the first position),
+         *      where the element string is segmented for the least number of bits
+         *      in the chosen version.
+         *      Throws an invalid argument exception for malformed element strings.
+         */
+        [[nodiscard]] static QrCode makeGs1(
+                const std::wstring&,
+                Ecl ecl = Ecl::L,
+                int version = -1,
+                int mask = -1,
+                MaskPolicy mask_policy = MaskPolicy::EXACT);
+
+        /*
+         * Pre-Conditions:
+         *      Data string (0x5C values must be doubled, ECI is not supported),
+         *
+         *      optional ECL (M1 supports error detection only & is generated
+         *                    under Ecl::L, M2 & M3 support Ecl::L & Ecl::M,
+         *                    M4 supports Ecl::L, Ecl::M, & Ecl::Q),
+         *
+         *      optional override mode used to determine the encoding method manually,
+         *
+         *      optional version in [1, 4] for M1 to M4 (-1 for auto,
+         *      a length exception is thrown if the data does not fit),
+         *
+         *      optional mask in [0, 3] (-1 for auto).
+         *
+         * Post-Conditions:
+         *      Generates a Micro QR code, which has a single finder pattern
+         *      & requires a quiet zone of only 2X (Check 6.3.8).
+         */
+        [[nodiscard]] static QrCode makeMicro(
+                const std::variant<std::wstring, std::string>&,
+                Ecl ecl = Ecl::L,
+                Designator override_mode = Designator::TERMINATOR,
+                int version = -1,
+                int mask = -1);
+
         /*
          * Pre-Conditions:
          *      None.
@@ -147,10 +441,100 @@ namespace Qrio {
          *      Returns the QR ECL.
          */
         [[nodiscard, maybe_unused]] Ecl getEcl() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns true if the QR code is a Micro QR code,
+         *      its version then refers to M1 to M4.
+         */
+        [[nodiscard, maybe_unused]] bool isMicro() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the row major module matrix, at(row, column) is true for dark modules.
+         */
+        [[nodiscard]] const SquareMatrix& getMatrix() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the wall time & allocations of each stage of the construction,
+         *      empty unless built with QRIO_PROFILING (Check Profiler).
+         */
+        [[nodiscard]] StageProfile getProfile() const;
     private:
+        /* Maximum number of QR codes in a structured append sequence */
+        const static int MAX_STRUCTURED{16};
+
+#ifdef QRIO_PROFILING
+        /* Stages of the construction, set before the matrix is built */
+        StageProfile profile;
+#endif
+
         /* Stores the generated QR code */
         Structurer matrix;
 
+        /*
+         * Pre-Conditions:
+         *      Structured QR matrix.
+         *
+         * Post-Conditions:
+         *      Wraps the given matrix.
+         */
+        explicit QrCode(Structurer);
+
+        /*
+         * Pre-Conditions:
+         *      Data string of one part,
+         *      ECL,
+         *      encoding method,
+         *      preferred version,
+         *      mask,
+         *      fnc1 mode,
+         *      structured append ID, count, & parity of the whole message,
+         *      mask policy.
+         *
+         * Post-Conditions:
+         *      Returns the QR code of the given part of a structured append message.
+         */
+        [[nodiscard]] static QrCode makePart(const std::wstring&,
+                                             Ecl, Designator, int, int,
+                                             int, int, int, int, MaskPolicy);
+
+        /*
+         * Pre-Conditions:
+         *      Data string of one part,
+         *      ECL,
+         *      version to be tested,
+         *      encoding method,
+         *      fnc1 mode,
+         *      parity of the whole message.
+         *
+         * Post-Conditions:
+         *      Returns true if the part fits in a structured append QR code
+         *      of the given version, otherwise false.
+         */
+        [[nodiscard]] static bool testPart(const std::wstring&,
+                                           Ecl, int, Designator, int, int);
+
+        /*
+         * Pre-Conditions:
+         *      Data string.
+         *
+         * Post-Conditions:
+         *      Returns the ascending indices at which the data string can be split
+         *      without breaking an escape sequence, including 0 & its size.
+         */
+        [[nodiscard]] static std::vector<size_t> getCutPositions(const std::wstring&);
+
         /*
          * Pre-Conditions:
          *      Data string,
@@ -167,6 +551,37 @@ namespace Qrio {
                 const std::variant<std::wstring, std::string>&,
                 Ecl, int, Designator);
 
+        /*
+         * Pre-Conditions:
+         *      List of segments,
+         *      ECL,
+         *      Preferred version to be used,
+         *      fnc1 mode,
+         *      structured append ID & count.
+         *
+         * Post-Conditions:
+         *      Returns the preferred version if it can store the segments,
+         *      otherwise if it is not specified (or invalid), an appropriate
+         *      version is determined.
+         *      If no version can store the segments, a length exception is thrown.
+         */
+        [[nodiscard]] static int getVersion(const SegmentList&,
+                                            Ecl, int, int, int, int);
+
+        /*
+         * Pre-Conditions:
+         *      Preferred version to be used,
+         *      predicate returning true iff a version fits the data,
+         *      optional maximum version (4 for Micro QR codes).
+         *
+         * Post-Conditions:
+         *      Returns the preferred version if it is valid & fits,
+         *      otherwise the smallest fitting version is searched for.
+         *      If no version fits, a length exception is thrown.
+         */
+        [[nodiscard]] static int findVersion(int, const std::function<bool(int)>&,
+                                             int max_version = DataAnalyzer::MAX_VERSION);
+
         /*
          * Pre-Conditions:
          *      Data string.
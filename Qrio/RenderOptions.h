@@ -0,0 +1,67 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_RENDEROPTIONS_H
+#define QR_IO_RENDEROPTIONS_H
+
+#include "Color.h"
+#include "PngStrategy.h"
+
+
+namespace Qrio {
+    /*
+     * RenderOptions: 1.0
+     *
+     * Describes how a QR code is rendered into an image.
+     * The defaults match QrCode::save.
+     */
+    class RenderOptions final {
+    public:
+        /* Size of a module in pixels */
+        int scale{10};
+
+        /* Quiet zone in modules, Check 6.3.8 */
+        int border_width{4};
+
+        /* Color of the light modules & the quiet zone */
+        Color light_color{255, 255, 255};
+
+        /* Color of the dark modules */
+        Color dark_color{0, 0, 0};
+
+        /* PNG compression level in [0, 9], -1 for the encoder's default */
+        int png_compression{-1};
+
+        /* PNG compression strategy */
+        PngStrategy png_strategy{PngStrategy::DEFAULT};
+
+        /* JPEG quality in [0, 100], used by the OpenCV adapter */
+        int jpeg_quality{95};
+
+        /* Printer resolution in DPI, used by PCL */
+        int printer_resolution{300};
+    };
+}
+
+
+#endif //QR_IO_RENDEROPTIONS_H
@@ -0,0 +1,55 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_SHEETLAYOUT_H
+#define QR_IO_SHEETLAYOUT_H
+
+
+namespace Qrio {
+    /*
+     * SheetLayout: 1.0
+     *
+     * Describes the grid of a label sheet, all sizes are in pixels.
+     * Symbols are centered in their cells, which are filled row by row.
+     */
+    class SheetLayout final {
+    public:
+        /* Number of cells per row */
+        int columns{8};
+
+        /* Side of a cell, 0 for the side of the largest symbol */
+        int cell_size{0};
+
+        /* Gap between neighbouring cells */
+        int spacing{20};
+
+        /* Margin around the grid */
+        int margin{40};
+
+        /* Number of worker threads, 0 for the hardware concurrency */
+        int threads{0};
+    };
+}
+
+
+#endif //QR_IO_SHEETLAYOUT_H
@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_SHIFTJIS_H
+#define QR_IO_SHIFTJIS_H
+
+#include "ShiftJisTable.h"
+
+
+namespace Qrio {
+    /*
+     * ShiftJis: 1.0
+     *
+     * Compile time Unicode to Shift JIS conversion of the double byte
+     * characters that can be encoded in Kanji mode.
+     * The lookup goes through two levels (high byte page, then low byte),
+     * unmapped pages take no space.
+     *
+     * Check 7.4.6
+     */
+    class ShiftJis final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Unicode code point.
+         *
+         * Post-Conditions:
+         *      Returns the Shift JIS code of the given code point,
+         *      or 0 if it cannot be encoded in Kanji mode.
+         */
+        [[nodiscard]] constexpr static int fromUnicode(long c) {
+            if (c < 0 or 0xFFFF < c) {
+                return 0;
+            }
+
+            const int page{SHIFT_JIS_PAGE_INDEX[c >> 8]};
+
+            return page == 0 ? 0 : SHIFT_JIS_PAGES[page - 1][c & 0xFF];
+        }
+
+        /*
+         * Pre-Conditions:
+         *      Unicode code point.
+         *
+         * Post-Conditions:
+         *      Returns true if the given code point can be encoded in Kanji mode.
+         */
+        [[nodiscard]] constexpr static bool isKanji(long c) {
+            return fromUnicode(c) != 0;
+        }
+    };
+
+    /* Kanji (U+6F22), Katakana (U+30A2), & unmapped (U+00E9) */
+    static_assert(ShiftJis::fromUnicode(0x6F22) == 0x8ABF);
+    static_assert(ShiftJis::fromUnicode(0x30A2) == 0x8341);
+    static_assert(not ShiftJis::isKanji(0xE9));
+}
+
+
+#endif //QR_IO_SHIFTJIS_H
@@ -24,6 +24,7 @@
 #ifndef QR_IO_SQUAREMATRIX_H
 #define QR_IO_SQUAREMATRIX_H
 
+#include <cstddef>
 #include <vector>
 
 
@@ -0,0 +1,60 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_STAGE_H
+#define QR_IO_STAGE_H
+
+#include <cstddef>
+
+
+namespace Qrio {
+    /*
+     * Enumerates the stages of the QR code pipeline recorded by the Profiler.
+     * ESCAPES: Parsing of the 0x5C escapes & ECI designators,
+     * VERSION_SEARCH: Search of the smallest fitting version, including its probes,
+     * ANALYSIS: DataAnalyzer segmentation,
+     * ENCODING: Encoder bit packing,
+     * ERROR_CORRECTION: ErrorCorrectionEncoder Reed-Solomon blocks & interleaving,
+     * STRUCTURE: Structurer drawing of the patterns & codewords,
+     * MASK_SEARCH: Selection of the mask,
+     * RENDERING: Image output,
+     * DETECTION: Search of a QR code in an image (CodeFinder::find).
+     */
+    enum class Stage {
+        ESCAPES,
+        VERSION_SEARCH,
+        ANALYSIS,
+        ENCODING,
+        ERROR_CORRECTION,
+        STRUCTURE,
+        MASK_SEARCH,
+        RENDERING,
+        DETECTION,
+    };
+
+    /* Number of stages */
+    constexpr size_t STAGE_COUNT{9};
+}
+
+
+#endif //QR_IO_STAGE_H
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "StageProfile.h"
+
+
+namespace Qrio {
+    using std::accumulate, std::max, std::max_element;
+
+    /*
+     * Pre-Conditions:
+     *      Stage.
+     *
+     * Post-Conditions:
+     *      Returns the wall time of the stage in seconds.
+     */
+    double StageProfile::getSeconds(Stage stage) const {
+        return static_cast<double>(nanoseconds[static_cast<size_t>(stage)]) / 1e9;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the wall time of all the stages in seconds.
+     */
+    double StageProfile::getTotalSeconds() const {
+        return static_cast<double>(accumulate(nanoseconds.begin(), nanoseconds.end(), uint64_t{0})) / 1e9;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the number of allocations of all the stages.
+     */
+    uint64_t StageProfile::getTotalAllocations() const {
+        return accumulate(allocations.begin(), allocations.end(), uint64_t{0});
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the bytes requested by all the stages.
+     */
+    uint64_t StageProfile::getTotalBytes() const {
+        return accumulate(bytes.begin(), bytes.end(), uint64_t{0});
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the largest peak heap growth of the stages.
+     */
+    uint64_t StageProfile::getPeakBytes() const {
+        return *max_element(peak_bytes.begin(), peak_bytes.end());
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Other profile.
+     *
+     * Post-Conditions:
+     *      Adds the other profile to this one, peaks are their maximum.
+     */
+    StageProfile& StageProfile::operator+=(const StageProfile& other) {
+        for (size_t i{0}; i < STAGE_COUNT; i++) {
+            calls[i] += other.calls[i];
+            nanoseconds[i] += other.nanoseconds[i];
+            allocations[i] += other.allocations[i];
+            bytes[i] += other.bytes[i];
+            peak_bytes[i] = max(peak_bytes[i], other.peak_bytes[i]);
+        }
+
+        probes += other.probes;
+        symbols += other.symbols;
+
+        return *this;
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_STAGEPROFILE_H
+#define QR_IO_STAGEPROFILE_H
+
+#include <array>
+#include <cstdint>
+
+#include "Stage.h"
+
+
+namespace Qrio {
+    /*
+     * StageProfile: 1.0
+     *
+     * Wall time & allocations of each pipeline stage, for one QR code or summed over many.
+     * The time & allocations of a stage exclude the ones of the stages nested in it.
+     */
+    class StageProfile final {
+    public:
+        /* Number of times each stage was recorded, indexed by Stage */
+        std::array<uint64_t, STAGE_COUNT> calls{};
+
+        /* Wall time of each stage in nanoseconds, indexed by Stage */
+        std::array<uint64_t, STAGE_COUNT> nanoseconds{};
+
+        /* Number of operator new calls of each stage, indexed by Stage */
+        std::array<uint64_t, STAGE_COUNT> allocations{};
+
+        /* Bytes requested from operator new by each stage, indexed by Stage */
+        std::array<uint64_t, STAGE_COUNT> bytes{};
+
+        /*
+         * Peak heap growth during each stage & the stages nested in it, indexed by Stage,
+         * the maximum over the summed profiles (only with QRIO_HEAP_PROFILING)
+         */
+        std::array<uint64_t, STAGE_COUNT> peak_bytes{};
+
+        /* Number of versions tried by the version search */
+        uint64_t probes{0};
+
+        /* Number of QR codes (or CodeFinder::find calls) summed */
+        uint64_t symbols{0};
+
+        /*
+         * Pre-Conditions:
+         *      Stage.
+         *
+         * Post-Conditions:
+         *      Returns the wall time of the stage in seconds.
+         */
+        [[nodiscard]] double getSeconds(Stage) const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the wall time of all the stages in seconds.
+         */
+        [[nodiscard]] double getTotalSeconds() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the number of allocations of all the stages.
+         */
+        [[nodiscard]] uint64_t getTotalAllocations() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the bytes requested by all the stages.
+         */
+        [[nodiscard]] uint64_t getTotalBytes() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns the largest peak heap growth of the stages.
+         */
+        [[nodiscard]] uint64_t getPeakBytes() const;
+
+        /*
+         * Pre-Conditions:
+         *      Other profile.
+         *
+         * Post-Conditions:
+         *      Adds the other profile to this one, peaks are their maximum.
+         */
+        StageProfile& operator+=(const StageProfile&);
+    };
+}
+
+
+#endif //QR_IO_STAGEPROFILE_H
@@ -24,49 +24,58 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <climits>
 #include <deque>
-#include <functional>
 #include <utility>
 #include <stdexcept>
 #include <vector>
 
+#include "Profiler.h"
 #include "Structurer.h"
 
 
 namespace Qrio {
     using std::abs, std::array, std::copy_backward,
-            std::deque, std::domain_error, std::function,
+            std::deque, std::domain_error,
             std::max, std::vector;
 
     /*
      * Pre-Conditions:
-     *      None.
+     *      optional stride between the evaluated rows & columns,
+     *      optional mask to preview without applying it (-1 for none).
      *
      * Post-Conditions:
      *      Calculates the penalty score for the current state of the
-     *      matrix.
+     *      matrix, a stride above 1 estimates the score from a sample.
      *
      * Check 7.8.3
      */
-    long Structurer::getPenalty() {
+    long Structurer::getPenalty(size_t stride, int preview_mask) {
         /* Based on Table 11 page 54 */
         static const int penalties[4]{
             3, 3, 40, 10
         };
 
+        /* Color of a module, with the previewed mask applied */
+        const auto dark{[&](size_t x, size_t y) -> bool {
+            return module(x, y) != (preview_mask != -1
+                                    and getMaskBit(preview_mask, x, y)
+                                    and not function_modules.at(y, x));
+        }};
+
         long result{0};
         bool color;
         int dark_counter{0}, x_cycles, y_cycles;
         array<int, 7> run_history{};
 
         /* Adjacent modules in row having same color, and finder-like patterns */
-        for (size_t y{0}; y < size(); y++) {
+        for (size_t y{0}; y < size(); y += stride) {
             color = false;
             x_cycles = 0;
             run_history = {};
 
             for (size_t x{0}; x < size(); x++) {
-                if (module(x, y) == color) {
+                if (dark(x, y) == color) {
                     x_cycles++;
 
                     if (x_cycles == 5) {
@@ -81,7 +90,7 @@ namespace Qrio {
                         result += penalties[2] * finderPenaltyCountPatterns(run_history);
                     }
 
-                    color = module(x, y);
+                    color = dark(x, y);
                     x_cycles = 1;
                 }
             }
@@ -90,13 +99,13 @@ namespace Qrio {
         }
 
         /* Adjacent modules in column having same color, and finder-like patterns */
-        for (size_t x{0}; x < size(); x++) {
+        for (size_t x{0}; x < size(); x += stride) {
             color = false;
             y_cycles = 0;
             run_history = {};
 
             for (size_t y{0}; y < size(); y++) {
-                if (module(x, y) == color) {
+                if (dark(x, y) == color) {
                     y_cycles++;
 
                     if (y_cycles == 5) {
@@ -111,7 +120,7 @@ namespace Qrio {
                         result += penalties[2] * finderPenaltyCountPatterns(run_history);
                     }
 
-                    color = module(x, y);
+                    color = dark(x, y);
                     y_cycles = 1;
                 }
             }
@@ -120,32 +129,35 @@ namespace Qrio {
         }
 
         /* 2x2 blocks of modules having same color */
-        for (size_t y{0}; y < size() - 1; y++) {
+        for (size_t y{0}; y < size() - 1; y += stride) {
             for (size_t x{0}; x < size() - 1; x++) {
-                color = module(x, y);
+                color = dark(x, y);
 
-                if (color == module(x + 1, y)
-                        and color == module(x, y + 1)
-                        and color == module(x + 1, y + 1)) {
+                if (color == dark(x + 1, y)
+                        and color == dark(x, y + 1)
+                        and color == dark(x + 1, y + 1)) {
                     result += penalties[1];
                 }
             }
         }
 
         /* Balance of dark and light modules */
-        for (const auto& row: *this) {
-            for (auto module: row) {
-                if (module) {
+        size_t rows{0};
+
+        for (size_t y{0}; y < size(); y += stride, rows++) {
+            for (size_t x{0}; x < size(); x++) {
+                if (dark(x, y)) {
                     dark_counter++;
                 }
             }
         }
 
-        const auto area{static_cast<long>(getArea())};
+        const auto area{static_cast<long>(rows * size())};
 
-        /* Compute the smallest integer k >= 0 such that (45-5k)% <= dark/total <= (55+5k)% */
-        int k{static_cast<int>(
-                (abs(dark_counter * 20 - area * 10) + area - 1) / area) - 1};
+        /* Compute the smallest integer k >= 0 such that (45-5k)% <= dark/total <= (55+5k)%,
+         * a sampled area can be even & exactly balanced, which would give -1 */
+        int k{max(0, static_cast<int>(
+                (abs(dark_counter * 20 - area * 10) + area - 1) / area) - 1)};
 
         assert(0 <= k and k <= 9);
         result += k * penalties[3];
@@ -159,7 +171,9 @@ namespace Qrio {
     /*
      * Pre-Conditions:
      *      Reference to the ErrorCorrectionEncoder from the previous layer,
-     *      optional final_mask.
+     *      optional final_mask,
+     *      optional mask selection policy (used iff final_mask is -1),
+     *      optional previous symbol of the same size to stay close to (null for none).
      *
      * Post-Conditions:
      *      Fills the QR code matrix with the data bits & other information,
@@ -168,17 +182,19 @@ namespace Qrio {
      *
      * Check 7.7 -> 7.10
      */
-    Structurer::Structurer(const ErrorCorrectionEncoder& ec_encoder, int mask):
+    Structurer::Structurer(const ErrorCorrectionEncoder& ec_encoder, int mask,
+                           MaskPolicy policy, const SquareMatrix* previous):
             SquareMatrix(ec_encoder.getMatrixSize()), // Initialize super class
             ec_encoder{ec_encoder},
             final_mask{mask},
             function_modules(ec_encoder.getMatrixSize()) {
+        QRIO_PROFILE_STAGE(Stage::STRUCTURE);
 
         drawFunctionPatterns();
         drawCodewords();
 
         if (final_mask == -1) {
-            final_mask = generateMask();
+            final_mask = generateMask(policy, previous);
         }
 
         applyMask(final_mask);
@@ -299,6 +315,11 @@ namespace Qrio {
      * Check 7.8
      */
     void Structurer::drawFormatBits(int mask) {
+        if (isMicro()) {
+            drawMicroFormatBits(mask);
+            return;
+        }
+
         const auto ecl_bits{
             ec_encoder.encoder.analyzer.getEclBits()
         };
@@ -340,6 +361,42 @@ namespace Qrio {
         setFunctionModule(8, size() - 8, true);
     }
 
+    /*
+     * Pre-Conditions:
+     *      Micro QR mask value.
+     *
+     * Post-Conditions:
+     *      Draws the single copy of the Micro QR format bits
+     *      based on the given final_mask and the symbol number.
+     *
+     * Check 7.9.2
+     */
+    void Structurer::drawMicroFormatBits(int mask) {
+        const auto symbol_number{
+            ec_encoder.encoder.analyzer.getSymbolNumber()
+        };
+
+        /* Calculate error correction code & pack bits */
+        int data{symbol_number << 2 | mask};
+        int rem{data};
+
+        for (int i{0}; i < 10; i++) {
+            rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+        }
+
+        int bits{(data << 10 | rem) ^ 0x4445};
+        assert(bits >> 15 == 0);
+
+        /* Column right of the finder pattern, then the row below it */
+        for (int i{0}; i < 8; i++) {
+            setFunctionModule(8, i + 1, getBit(bits, i));
+        }
+
+        for (int i{8}; i < 15; i++) {
+            setFunctionModule(15 - i, 8, getBit(bits, i));
+        }
+    }
+
     /*
      * Pre-Conditions:
      *      None.
@@ -349,6 +406,11 @@ namespace Qrio {
      *      and draws and marks all function modules.
      */
     void Structurer::drawFunctionPatterns() {
+        if (isMicro()) {
+            drawMicroFunctionPatterns();
+            return;
+        }
+
         /* Draw horizontal & vertical timing patterns */
         for (size_t i{0}; i < size(); i++) {
             setFunctionModule(6, i, i % 2 == 0);
@@ -383,6 +445,30 @@ namespace Qrio {
         drawVersion();
     }
 
+    /*
+     * Pre-Conditions:
+     *      Micro QR code.
+     *
+     * Post-Conditions:
+     *      Draws and marks the single finder pattern,
+     *      the timing patterns, & the format information area.
+     *
+     * Check 6.3.3
+     */
+    void Structurer::drawMicroFunctionPatterns() {
+        /* Timing patterns run along the top row & the left column */
+        for (size_t i{8}; i < size(); i++) {
+            setFunctionModule(i, 0, i % 2 == 0);
+            setFunctionModule(0, i, i % 2 == 0);
+        }
+
+        /* Finder pattern with its separator */
+        drawFinderPattern(3, 3);
+
+        /* Dummy mask value, later overwritten */
+        drawMicroFormatBits(0);
+    }
+
     /*
      * Pre-Conditions:
      *      None.
@@ -395,24 +481,32 @@ namespace Qrio {
         assert(ec_encoder.size() ==
                 static_cast<size_t>(ec_encoder.encoder.getVersionBitCount() / 8));
 
+        /* The final data codeword of M1 & M3 is only 4 bits long */
+        const auto data_bits{static_cast<size_t>(ec_encoder.encoder.getDataBitCount())};
+
         size_t bit_index{0}, x, y;
         bool is_upward;
 
         for (long right = static_cast<long>(size() - 1); 1 <= right; right -= 2) {
-            if (right == 6) {
+            /* Skip the vertical timing pattern, Micro QR codes have it on the edge */
+            if (right == 6 and not isMicro()) {
                 right--;
             }
 
             for (size_t v{0}; v < size(); v++) {
                 for (int j{0}; j < 2; j++) {
                     x = right - j;
-                    is_upward = ((right + 1) & 2) == 0;
+                    is_upward = ((size() - 1 - right) & 2) == 0;
                     y = is_upward ? size() - v - 1 : v;
 
                     if (not function_modules.at(y, x) and bit_index < 8 * ec_encoder.size()) {
                         at(y, x) = getBit(ec_encoder.at(bit_index >> 3),
                                           static_cast<int>(7 - static_cast<int>(bit_index & 7)));
                         bit_index++;
+
+                        if (bit_index == data_bits and data_bits % 8) {
+                            bit_index += 8 - data_bits % 8;
+                        }
                     }
                 }
             }
@@ -534,7 +628,7 @@ namespace Qrio {
 
     /*
      * Pre-Conditions:
-     *      Mask value.
+     *      Mask value ([0, 3] for Micro QR codes).
      *
      * Post-Conditions:
      *      Applies the given final_mask onto the matrix.
@@ -542,78 +636,202 @@ namespace Qrio {
      * Check 7.8
      */
     void Structurer::applyMask(int mask) {
-        /* Mask functions array */
-        const static function<bool(size_t, size_t)> mask_functions[8]{
-           [](size_t x, size_t y) {
-               return (x + y) % 2 == 0;
-           },
-           [](size_t, size_t y) {
-               return y % 2 == 0;
-           },
-           [](size_t x, size_t) {
-               return x % 3 == 0;
-           },
-           [](size_t x, size_t y) {
-               return (x + y) % 3 == 0;
-           },
-           [](size_t x, size_t y) {
-               return (x / 3 + y / 2) % 2 == 0;
-           },
-           [](size_t x, size_t y) {
-               return x * y % 2 + x * y % 3 == 0;
-           },
-           [](size_t x, size_t y) {
-               return (x * y % 2 + x * y % 3) % 2 == 0;
-           },
-           [](size_t x, size_t y) {
-               return ((x + y) % 2 + x * y % 3) % 2 == 0;
-           }
-        };
+        if (isMicro()) {
+            if (mask < 0 or 3 < mask) {
+                throw domain_error("Micro QR mask out of range [0, 3]");
+            }
 
-        if (mask < 0 or 7 < mask) {
+            mask = MICRO_MASK_PATTERNS[mask];
+        } else if (mask < 0 or 7 < mask) {
             throw domain_error("Mask out of range [0, 7]");
         }
 
-        const auto& func{mask_functions[mask]};
-
         for (size_t y{0}; y < size(); y++) {
             for (size_t x{0}; x < size(); x++) {
-                at(y, x) = at(y, x) ^ (func(x, y) and not function_modules.at(y, x));
+                at(y, x) = at(y, x) ^ (getMaskBit(mask, x, y) and not function_modules.at(y, x));
             }
         }
     }
 
     /*
      * Pre-Conditions:
-     *      None.
+     *      Mask value in [0, 7],
+     *      coordinates of a module.
+     *
+     * Post-Conditions:
+     *      Returns true if the mask inverts the given module.
+     *
+     * Check 7.8.2
+     */
+    bool Structurer::getMaskBit(int mask, size_t x, size_t y) {
+        switch (mask) {
+            case 0:
+                return (x + y) % 2 == 0;
+            case 1:
+                return y % 2 == 0;
+            case 2:
+                return x % 3 == 0;
+            case 3:
+                return (x + y) % 3 == 0;
+            case 4:
+                return (x / 3 + y / 2) % 2 == 0;
+            case 5:
+                return x * y % 2 + x * y % 3 == 0;
+            case 6:
+                return (x * y % 2 + x * y % 3) % 2 == 0;
+            case 7:
+                return ((x + y) % 2 + x * y % 3) % 2 == 0;
+            default:
+                throw domain_error("Mask out of range [0, 7]");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Mask selection policy,
+     *      optional previous symbol of the same size (null for none).
      *
      * Post-Conditions:
-     *      Returns the best final_mask for the given data.
+     *      Returns the best final_mask for the given data. With a previous symbol,
+     *      returns the mask changing the fewest of its modules among the near best ones.
      *
      * Check 7.8.3
      */
-    int Structurer::generateMask() {
+    int Structurer::generateMask(MaskPolicy policy, const SquareMatrix* previous) {
+        QRIO_PROFILE_STAGE(Stage::MASK_SEARCH);
+
+        if (isMicro()) {
+            return generateMicroMask();
+        }
+
         int result{-1};
-        long min_penalty{LONG_MAX}, penalty;
+        long min_penalty{LONG_MAX};
+        array<long, 8> penalties{};
+        array<size_t, 8> changes{};
 
         for (int i{0}; i < 8; i++) {
-            applyMask(i);
             drawFormatBits(i);
 
-            penalty = getPenalty();
+            if (policy == MaskPolicy::FAST) {
+                /* Estimated on a sample, the mask is only previewed */
+                penalties[i] = getPenalty(SAMPLE_STRIDE, i);
+                changes[i] = previous != nullptr ? getChanges(*previous, i) : 0;
+            } else {
+                applyMask(i);
+                penalties[i] = getPenalty();
+                changes[i] = previous != nullptr ? getChanges(*previous) : 0;
+
+                /* Undoes the mask due to XOR */
+                applyMask(i);
+            }
 
-            if (penalty < min_penalty) {
-                min_penalty = penalty;
+            if (penalties[i] < min_penalty) {
+                min_penalty = penalties[i];
                 result = i;
             }
+        }
+
+        if (previous != nullptr) {
+            for (int i{0}; i < 8; i++) {
+                if (penalties[i] <= min_penalty + min_penalty / PENALTY_SLACK and changes[i] < changes[result]) {
+                    result = i;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Previous symbol of the same size, in its final orientation,
+     *      optional mask to preview without applying it (-1 for none).
+     *
+     * Post-Conditions:
+     *      Returns the number of modules differing from the previous symbol.
+     */
+    size_t Structurer::getChanges(const SquareMatrix& previous, int preview_mask) {
+        const size_t n{size()};
+        size_t result{0};
+
+        for (size_t y{0}; y < n; y++) {
+            for (size_t x{0}; x < n; x++) {
+                const bool dark{module(x, y) != (preview_mask != -1
+                                                 and getMaskBit(preview_mask, x, y)
+                                                 and not function_modules.at(y, x))};
+
+                if (dark != previous.module(x, y)) {
+                    result++;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Micro QR code.
+     *
+     * Post-Conditions:
+     *      Returns the Micro QR mask with the highest evaluation score.
+     *
+     * Check 7.8.3.2
+     */
+    int Structurer::generateMicroMask() {
+        int result{-1};
+        long max_score{-1}, score;
+
+        for (int i{0}; i < 4; i++) {
+            applyMask(i);
+            score = getMicroScore();
 
             /* Undoes the mask due to XOR */
             applyMask(i);
+
+            if (max_score < score) {
+                max_score = score;
+                result = i;
+            }
         }
 
         return result;
     }
 
+    /*
+     * Pre-Conditions:
+     *      Micro QR code.
+     *
+     * Post-Conditions:
+     *      Returns the evaluation score of the current state of the matrix,
+     *      based on the dark modules of the right & lower edges.
+     *
+     * Check 7.8.3.2
+     */
+    long Structurer::getMicroScore() const {
+        long right_count{0}, lower_count{0};
+
+        /* The timing patterns are excluded */
+        for (size_t i{1}; i < size(); i++) {
+            right_count += module(size() - 1, i);
+            lower_count += module(i, size() - 1);
+        }
+
+        return right_count <= lower_count ? right_count * 16 + lower_count
+                                          : lower_count * 16 + right_count;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns true if the symbol is a Micro QR code.
+     */
+    bool Structurer::isMicro() const {
+        return ec_encoder.encoder.analyzer.isMicro();
+    }
+
     /*
      * Pre-Conditions:
      *      None.
@@ -630,7 +848,7 @@ namespace Qrio {
 
         for (size_t i{0}; i < size(); ++i) {
             for (size_t j{i + 1}; j < size(); ++j) {
-                std::swap((*this)[i][j], (*this)[j][i]);
+                vector<bool>::swap((*this)[i][j], (*this)[j][i]);
             }
         }
     }
@@ -647,7 +865,7 @@ namespace Qrio {
     void Structurer::flip() {
         for (size_t i{0}; i < size() / 2; i++) {
             for (size_t j{0}; j < size(); ++j) {
-                std::swap(at(i, j), at(size() - 1 - i, j));
+                vector<bool>::swap(at(i, j), at(size() - 1 - i, j));
             }
         }
     }
@@ -662,4 +880,19 @@ namespace Qrio {
      * Default constructor used temporarily by the QrCode class.
      */
     Structurer::Structurer(): final_mask{-1} {}
+
+    /*
+     * Pre-Conditions:
+     *      Finished QR code (not Micro).
+     *
+     * Post-Conditions:
+     *      Returns the exact penalty score of the symbol under its final mask,
+     *      used to compare the masks chosen by the mask policies.
+     *
+     * The penalty is symmetric in rows & columns, so rotate & flip do not change it.
+     * Check 7.8.3
+     */
+    long Structurer::getMaskPenalty() {
+        return getPenalty();
+    }
 }
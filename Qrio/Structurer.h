@@ -31,12 +31,13 @@
 #include <vector>
 
 #include "ErrorCorrectionEncoder.h"
+#include "MaskPolicy.h"
 #include "SquareMatrix.h"
 
 
 namespace Qrio {
     /*
-     * Structurer: 1.2
+     * Structurer: 1.4
      *
      * Responsible for structuring the final message, place modules,
      * data final_mask, & place the format information.
@@ -53,7 +54,9 @@ namespace Qrio {
         /*
          * Pre-Conditions:
          *      Reference to the ErrorCorrectionEncoder from the previous layer,
-         *      optional final_mask.
+         *      optional final_mask,
+         *      optional mask selection policy (used iff final_mask is -1),
+         *      optional previous symbol of the same size to stay close to (null for none).
          *
          * Post-Conditions:
          *      Fills the QR code matrix with the data bits & other information,
@@ -62,7 +65,9 @@ namespace Qrio {
          *
          * Check 7.7 -> 7.10
          */
-        explicit Structurer(const ErrorCorrectionEncoder&, int mask = -1);
+        explicit Structurer(const ErrorCorrectionEncoder&, int mask = -1,
+                            MaskPolicy policy = MaskPolicy::EXACT,
+                            const SquareMatrix* previous = nullptr);
 
         /*
          * Pre-Conditions:
@@ -74,7 +79,39 @@ namespace Qrio {
          * Default constructor used temporarily by the QrCode class.
          */
         Structurer();
+
+        /*
+         * Pre-Conditions:
+         *      Finished QR code (not Micro).
+         *
+         * Post-Conditions:
+         *      Returns the exact penalty score of the symbol under its final mask,
+         *      used to compare the masks chosen by the mask policies.
+         *
+         * Check 7.8.3
+         */
+        [[nodiscard]] long getMaskPenalty();
     private:
+        /*
+         * Distance between the sampled rows & columns
+         * when estimating the penalty score under MaskPolicy::FAST.
+         */
+        const static size_t SAMPLE_STRIDE{8};
+
+        /*
+         * Masks whose penalty exceeds the best one by at most 1/PENALTY_SLACK of it
+         * can be chosen instead, when they change fewer modules of a previous symbol.
+         */
+        const static long PENALTY_SLACK{4};
+
+        /*
+         * Data mask patterns of Micro QR codes [0, 3],
+         * mapped to their equivalent QR code masks.
+         *
+         * Based on Table 10 of ISO/IEC 18004:2015.
+         */
+        constexpr static int MICRO_MASK_PATTERNS[4]{1, 4, 6, 7};
+
         /*
          * Matrix of function modules.
          * These modules are not included in the masking.
@@ -94,18 +131,65 @@ namespace Qrio {
 
         /*
          * Pre-Conditions:
-         *      None.
+         *      Mask selection policy,
+         *      optional previous symbol of the same size (null for none).
          *
          * Post-Conditions:
-         *      Returns the best final_mask for the given data.
+         *      Returns the best final_mask for the given data. With a previous symbol,
+         *      returns the mask changing the fewest of its modules among the near best ones.
          *
          * Check 7.8.3
          */
-        [[nodiscard]] int generateMask();
+        [[nodiscard]] int generateMask(MaskPolicy policy = MaskPolicy::EXACT,
+                                       const SquareMatrix* previous = nullptr);
 
         /*
          * Pre-Conditions:
-         *      Mask value.
+         *      Micro QR code.
+         *
+         * Post-Conditions:
+         *      Returns the Micro QR mask with the highest evaluation score.
+         *
+         * Check 7.8.3.2
+         */
+        [[nodiscard]] int generateMicroMask();
+
+        /*
+         * Pre-Conditions:
+         *      Micro QR code.
+         *
+         * Post-Conditions:
+         *      Returns the evaluation score of the current state of the matrix,
+         *      based on the dark modules of the right & lower edges.
+         *
+         * Check 7.8.3.2
+         */
+        [[nodiscard]] long getMicroScore() const;
+
+        /*
+         * Pre-Conditions:
+         *      None.
+         *
+         * Post-Conditions:
+         *      Returns true if the symbol is a Micro QR code.
+         */
+        [[nodiscard]] bool isMicro() const;
+
+        /*
+         * Pre-Conditions:
+         *      Mask value in [0, 7],
+         *      coordinates of a module.
+         *
+         * Post-Conditions:
+         *      Returns true if the mask inverts the given module.
+         *
+         * Check 7.8.2
+         */
+        [[nodiscard]] static bool getMaskBit(int, size_t, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Mask value ([0, 3] for Micro QR codes).
          *
          * Post-Conditions:
          *      Applies the given final_mask onto the matrix.
@@ -126,15 +210,38 @@ namespace Qrio {
 
         /*
          * Pre-Conditions:
-         *      None.
+         *      Micro QR mask value.
+         *
+         * Post-Conditions:
+         *      Draws the single copy of the Micro QR format bits
+         *      based on the given final_mask and the symbol number.
+         *
+         * Check 7.9.2
+         */
+        void drawMicroFormatBits(int);
+
+        /*
+         * Pre-Conditions:
+         *      optional stride between the evaluated rows & columns,
+         *      optional mask to preview without applying it (-1 for none).
          *
          * Post-Conditions:
          *      Calculates the penalty score for the current state of the
-         *      matrix.
+         *      matrix, a stride above 1 estimates the score from a sample.
          *
          * Check 7.8.3
          */
-        [[nodiscard]] long getPenalty();
+        [[nodiscard]] long getPenalty(size_t stride = 1, int preview_mask = -1);
+
+        /*
+         * Pre-Conditions:
+         *      Previous symbol of the same size, in its final orientation,
+         *      optional mask to preview without applying it (-1 for none).
+         *
+         * Post-Conditions:
+         *      Returns the number of modules differing from the previous symbol.
+         */
+        [[nodiscard]] size_t getChanges(const SquareMatrix&, int preview_mask = -1);
 
         /*
          * Pre-Conditions:
@@ -156,6 +263,18 @@ namespace Qrio {
          */
         void drawFunctionPatterns();
 
+        /*
+         * Pre-Conditions:
+         *      Micro QR code.
+         *
+         * Post-Conditions:
+         *      Draws and marks the single finder pattern,
+         *      the timing patterns, & the format information area.
+         *
+         * Check 6.3.3
+         */
+        void drawMicroFunctionPatterns();
+
         /*
          * Pre-Conditions:
          *      Center of the pattern (x, y).
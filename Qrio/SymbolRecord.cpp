@@ -0,0 +1,241 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SymbolRecord.h"
+
+
+namespace Qrio {
+    using std::copy, std::invalid_argument, std::pair, std::to_string, std::vector;
+
+    /*
+     * Pre-Conditions:
+     *      QR code.
+     *
+     * Post-Conditions:
+     *      Copies the geometry of the QR code.
+     */
+    SymbolRecord::SymbolRecord(const QrCode& code) : version{code.getVersion()},
+                                                     mask{code.getMask()},
+                                                     ecl{code.getEcl()},
+                                                     micro{code.isMicro()},
+                                                     matrix{code.getMatrix()} {}
+
+    /*
+     * Pre-Conditions:
+     *      Stored bytes,
+     *      number of bytes.
+     *
+     * Post-Conditions:
+     *      Loads a record written by toBytes, the side must match the version
+     *      & the body must fill the record exactly.
+     *      Throws an invalid argument exception if the bytes are not a valid record.
+     */
+    SymbolRecord::SymbolRecord(const uint8_t* data, size_t size) : version{0}, mask{0}, ecl{Ecl::L}, micro{false} {
+        if (size < HEADER_SIZE or data[0] != 'Q' or data[1] != 'R' or data[2] != REVISION or (data[3] & ~3) != 0) {
+            throw invalid_argument("Not a symbol record");
+        }
+
+        micro = (data[3] & 1) != 0;
+        version = data[4];
+        mask = data[5];
+        ecl = static_cast<Ecl>(data[6] & 3);
+
+        const bool runs{(data[3] & 2) != 0};
+        const size_t S{data[7]};
+
+        if (version < 1 or version > (micro ? 4 : 40) or mask >= (micro ? 4 : 8) or data[6] > 3
+            or S != static_cast<size_t>(micro ? 9 + 2 * version : 17 + 4 * version)) {
+            throw invalid_argument("Invalid symbol record header");
+        }
+
+        matrix = SquareMatrix{S};
+
+        size_t offset{HEADER_SIZE};
+
+        if (not runs) {
+            if (size != HEADER_SIZE + (S * S + 7) / 8) {
+                throw invalid_argument("Invalid packed matrix size " + to_string(size));
+            }
+
+            for (size_t k{0}; k < S * S; k++) {
+                matrix[k / S][k % S] = (data[offset + k / 8] >> (7 - k % 8) & 1) != 0;
+            }
+
+            return;
+        }
+
+        for (size_t i{0}; i < S; i++) {
+            if (offset >= size or offset + 1 + 2 * data[offset] > size) {
+                throw invalid_argument("Truncated run list at row " + to_string(i));
+            }
+
+            const size_t count{data[offset++]};
+
+            for (size_t k{0}; k < count; k++, offset += 2) {
+                const size_t first{data[offset]}, length{data[offset + 1]};
+
+                if (first + length > S) {
+                    throw invalid_argument("Run outside of the matrix at row " + to_string(i));
+                }
+
+                for (size_t j{first}; j < first + length; j++) {
+                    matrix[i][j] = true;
+                }
+            }
+        }
+
+        if (offset != size) {
+            throw invalid_argument("Trailing bytes after the run list");
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Optional matrix encoding (default the smaller one).
+     *
+     * Post-Conditions:
+     *      Returns the binary record.
+     */
+    vector<uint8_t> SymbolRecord::toBytes(MatrixEncoding encoding) const {
+        const size_t S{matrix.size()};
+        const RunList rows{getRuns(matrix)};
+        const bool runs{encoding == MatrixEncoding::RUNS
+                        or (encoding == MatrixEncoding::AUTO and getRunsSize(rows) < (S * S + 7) / 8)};
+
+        const uint8_t header[HEADER_SIZE]{'Q', 'R', REVISION,
+                                          static_cast<uint8_t>((micro ? 1 : 0) | (runs ? 2 : 0)),
+                                          static_cast<uint8_t>(version), static_cast<uint8_t>(mask),
+                                          static_cast<uint8_t>(ecl), static_cast<uint8_t>(S)};
+
+        /* Sized once, the packed matrix is filled in place, the runs are appended */
+        vector<uint8_t> result(HEADER_SIZE + (runs ? 0 : (S * S + 7) / 8), 0);
+
+        copy(header, header + HEADER_SIZE, result.begin());
+
+        if (runs) {
+            result.reserve(HEADER_SIZE + getRunsSize(rows));
+
+            for (const auto& row: rows) {
+                result.push_back(static_cast<uint8_t>(row.size()));
+
+                for (const auto& [first, length]: row) {
+                    result.push_back(static_cast<uint8_t>(first));
+                    result.push_back(static_cast<uint8_t>(length));
+                }
+            }
+
+            return result;
+        }
+
+        for (size_t k{0}; k < S * S; k++) {
+            if (matrix[k / S][k % S]) {
+                result[HEADER_SIZE + k / 8] |= static_cast<uint8_t>(0x80 >> (k % 8));
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Module matrix.
+     *
+     * Post-Conditions:
+     *      Returns the runs of dark modules of every row.
+     */
+    RunList SymbolRecord::getRuns(const SquareMatrix& matrix) {
+        const size_t S{matrix.size()};
+        RunList result(S);
+
+        for (size_t i{0}; i < S; i++) {
+            const vector<bool>& row{matrix[i]};
+
+            for (size_t j{0}; j < S; j++) {
+                if (not row[j]) {
+                    continue;
+                }
+
+                const size_t first{j};
+
+                while (j < S and row[j]) {
+                    j++;
+                }
+
+                result[i].emplace_back(first, j - first);
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Runs of dark modules of every row.
+     *
+     * Post-Conditions:
+     *      Returns the module matrix, its side is the number of rows.
+     *      Throws an invalid argument exception if a run is outside of the matrix.
+     */
+    SquareMatrix SymbolRecord::fromRuns(const RunList& runs) {
+        const size_t S{runs.size()};
+        SquareMatrix result{S};
+
+        for (size_t i{0}; i < S; i++) {
+            for (const auto& [first, length]: runs[i]) {
+                if (first + length > S) {
+                    throw invalid_argument("Run outside of the matrix at row " + to_string(i));
+                }
+
+                for (size_t j{first}; j < first + length; j++) {
+                    result[i][j] = true;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Runs of dark modules of every row.
+     *
+     * Post-Conditions:
+     *      Returns the number of bytes the runs take in a record (one count per row, two per run).
+     */
+    size_t SymbolRecord::getRunsSize(const RunList& runs) {
+        size_t result{0};
+
+        for (const auto& row: runs) {
+            result += 1 + 2 * row.size();
+        }
+
+        return result;
+    }
+}
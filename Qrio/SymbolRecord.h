@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_SYMBOLRECORD_H
+#define QR_IO_SYMBOLRECORD_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Ecl.h"
+#include "MatrixEncoding.h"
+#include "QrCode.h"
+#include "SquareMatrix.h"
+
+
+namespace Qrio {
+    /* Runs of dark modules per row, as (first column, length) pairs */
+    typedef std::vector<std::vector<std::pair<size_t, size_t>>> RunList;
+
+    /*
+     * SymbolRecord: 1.0
+     *
+     * Finished symbol geometry (version, mask, ECL, & module matrix),
+     * stored in a compact binary form & loaded back without re-encoding.
+     * The matrix can be rendered directly by the bitmap, vector, & printer writers.
+     *
+     * Binary layout: 'Q' 'R', format revision, flags (1 Micro, 2 runs),
+     * version, mask, ECL bits, side, then either the packed matrix
+     * (row major, most significant bit first) or, for each row,
+     * the number of runs followed by (first column, length) byte pairs.
+     */
+    class SymbolRecord final {
+    public:
+        /* Version, 1 to 40 (1 to 4 for Micro QR codes) */
+        int version;
+
+        /* Mask pattern */
+        int mask;
+
+        /* Error correction level */
+        Ecl ecl;
+
+        /* Whether the symbol is a Micro QR code */
+        bool micro;
+
+        /* Row major module matrix, true for dark modules */
+        SquareMatrix matrix;
+
+        /*
+         * Pre-Conditions:
+         *      QR code.
+         *
+         * Post-Conditions:
+         *      Copies the geometry of the QR code.
+         */
+        explicit SymbolRecord(const QrCode&);
+
+        /*
+         * Pre-Conditions:
+         *      Stored bytes,
+         *      number of bytes.
+         *
+         * Post-Conditions:
+         *      Loads a record written by toBytes.
+         *      Throws an invalid argument exception if the bytes are not a valid record.
+         */
+        SymbolRecord(const uint8_t*, size_t);
+
+        /*
+         * Pre-Conditions:
+         *      Optional matrix encoding (default the smaller one).
+         *
+         * Post-Conditions:
+         *      Returns the binary record.
+         */
+        [[nodiscard]] std::vector<uint8_t> toBytes(MatrixEncoding encoding = MatrixEncoding::AUTO) const;
+
+        /*
+         * Pre-Conditions:
+         *      Module matrix.
+         *
+         * Post-Conditions:
+         *      Returns the runs of dark modules of every row.
+         */
+        [[nodiscard]] static RunList getRuns(const SquareMatrix&);
+
+        /*
+         * Pre-Conditions:
+         *      Runs of dark modules of every row.
+         *
+         * Post-Conditions:
+         *      Returns the module matrix, its side is the number of rows.
+         *      Throws an invalid argument exception if a run is outside of the matrix.
+         */
+        [[nodiscard]] static SquareMatrix fromRuns(const RunList&);
+
+    private:
+        /* Format revision of the binary record */
+        const static uint8_t REVISION{1};
+
+        /* Size of the binary header */
+        const static size_t HEADER_SIZE{8};
+
+        /*
+         * Pre-Conditions:
+         *      Runs of dark modules of every row.
+         *
+         * Post-Conditions:
+         *      Returns the number of bytes the runs take in a record.
+         */
+        [[nodiscard]] static size_t getRunsSize(const RunList&);
+    };
+}
+
+
+#endif //QR_IO_SYMBOLRECORD_H
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_VECTORWRITER_H
+#define QR_IO_VECTORWRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SquareMatrix.h"
+
+
+namespace Qrio {
+    /*
+     * VectorWriter: 1.0
+     *
+     * Writes a QR matrix as vector artwork (SVG, EPS, or PDF).
+     * Horizontal runs of dark modules are merged, & identical runs on
+     * consecutive rows are merged into a single rectangle, so the output
+     * size depends on the number of run transitions, not on the scale.
+     * Colors are given as 0xRRGGBB.
+     */
+    class VectorWriter final {
+    public:
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional size of a module in pixels,
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns an SVG document with a single path for the dark modules.
+         */
+        [[nodiscard]] static std::string toSvg(const SquareMatrix&,
+                                               int border_width = 4,
+                                               double module_size = 1,
+                                               uint32_t light_color = 0xFFFFFF,
+                                               uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional size of a module in points,
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns an Encapsulated PostScript document.
+         */
+        [[nodiscard]] static std::string toEps(const SquareMatrix&,
+                                               int border_width = 4,
+                                               double module_size = 1,
+                                               uint32_t light_color = 0xFFFFFF,
+                                               uint32_t dark_color = 0x000000);
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix,
+         *      optional border width in modules (default 4X, Check 6.3.8),
+         *      optional size of a module in points,
+         *      optional RGB light color (default white),
+         *      optional RGB dark color (default black).
+         *
+         * Post-Conditions:
+         *      Returns a single page PDF document.
+         */
+        [[nodiscard]] static std::string toPdf(const SquareMatrix&,
+                                               int border_width = 4,
+                                               double module_size = 1,
+                                               uint32_t light_color = 0xFFFFFF,
+                                               uint32_t dark_color = 0x000000);
+    private:
+        /* Rectangle of dark modules, in modules */
+        class Block final {
+        public:
+            size_t x;
+
+            size_t y;
+
+            size_t width;
+
+            size_t height;
+        };
+
+        /*
+         * Pre-Conditions:
+         *      Row major QR matrix.
+         *
+         * Post-Conditions:
+         *      Returns the rectangles covering exactly the dark modules,
+         *      built from the runs of each row, ordered by their top row.
+         */
+        [[nodiscard]] static std::vector<Block> getBlocks(const SquareMatrix&);
+
+        /*
+         * Pre-Conditions:
+         *      A number.
+         *
+         * Post-Conditions:
+         *      Returns the shortest fixed point representation of the number,
+         *      up to 6 decimals.
+         */
+        [[nodiscard]] static std::string formatNumber(double);
+
+        /*
+         * Pre-Conditions:
+         *      RGB color,
+         *      operator name.
+         *
+         * Post-Conditions:
+         *      Returns the "r g b operator" PostScript/PDF color command.
+         */
+        [[nodiscard]] static std::string getColorCommand(uint32_t, const std::string&);
+    };
+}
+
+
+#endif //QR_IO_VECTORWRITER_H
@@ -0,0 +1,289 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/BatchJob.h"
+#include "Qrio/PackWriter.h"
+#include "Qrio/SymbolRecord.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      None.
+ *
+ * Post-Conditions:
+ *      Prints the command line usage.
+ */
+void printUsage() {
+    cerr << "Usage: qrio-batch [options] [input]\n"
+            "Reads one payload per line from the input file (standard input if omitted or -),\n"
+            "either plain text or NDJSON {\"id\": \"...\", \"data\": \"...\", \"ecl\": \"L|M|Q|H\"}.\n"
+            "\n"
+            "Sinks (one of):\n"
+            "  --stdout              one NDJSON line per QR code with its hex symbol record (default)\n"
+            "  --out-dir <dir>       one image per QR code, named <dir>/<id>.<format>\n"
+            "  --pack <file>         one pack file of symbol records, & images if --format is given\n"
+            "\n"
+            "Options:\n"
+            "  --format <ext>        png, bmp, pbm, ppm, tiff, svg, eps, pdf, escpos, zpl or pcl (default png)\n"
+            "  --scale <n>           pixels (or dots, points) per module (default 10)\n"
+            "  --border <n>          quiet zone width in modules (default 4)\n"
+            "  --ecl <L|M|Q|H>       error correction level of the lines without one (default M)\n"
+            "  --exact               evaluate all the masks exactly instead of estimating them\n"
+            "  --threads <n>         worker threads (default the hardware concurrency)\n"
+            "  --block <n>           lines encoded in parallel per block (default 1024)\n"
+            "  --checkpoint <file>   record the progress & resume from it\n"
+            "  --interval <n>        lines between two checkpoints (default 10000)\n";
+}
+
+/*
+ * Pre-Conditions:
+ *      Name of an error correction level.
+ *
+ * Post-Conditions:
+ *      Returns the level, throws an invalid argument exception for unknown names.
+ */
+Ecl toEcl(const string& name) {
+    if (name == "L" or name == "l") {
+        return Ecl::L;
+    } else if (name == "M" or name == "m") {
+        return Ecl::M;
+    } else if (name == "Q" or name == "q") {
+        return Ecl::Q;
+    } else if (name == "H" or name == "h") {
+        return Ecl::H;
+    }
+
+    throw invalid_argument("Unknown ECL: " + name);
+}
+
+/*
+ * Pre-Conditions:
+ *      Key of an item.
+ *
+ * Post-Conditions:
+ *      Returns the key with the characters unsafe in file names replaced by underscores.
+ */
+string toFileName(const string& key) {
+    string result{key.empty() ? "_" : key};
+
+    for (char& c: result) {
+        if (not isalnum(static_cast<unsigned char>(c)) and c != '-' and c != '_' and c != '.') {
+            c = '_';
+        }
+    }
+
+    return result == "." or result == ".." ? "_" : result;
+}
+
+/*
+ * Pre-Conditions:
+ *      UTF-8 text.
+ *
+ * Post-Conditions:
+ *      Returns the text as a quoted JSON string.
+ */
+string toJson(const string& text) {
+    string result{"\""};
+
+    for (char c: text) {
+        if (c == '"' or c == '\\') {
+            result += '\\';
+            result += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escape[8];
+
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            result += escape;
+        } else {
+            result += c;
+        }
+    }
+
+    return result + '"';
+}
+
+
+int main(int argc, const char* argv[]) {
+    BatchOptions options{};
+    RenderOptions render_options{};
+    string input_path{}, out_dir{}, pack_path{}, extension{};
+
+    try {
+        for (int i{1}; i < argc; i++) {
+            const string arg{argv[i]};
+
+            const auto next{[&]() {
+                if (i + 1 >= argc) {
+                    throw invalid_argument("Missing value after " + arg);
+                }
+
+                return string{argv[++i]};
+            }};
+
+            if (arg == "--stdout") {
+                out_dir.clear();
+                pack_path.clear();
+            } else if (arg == "--out-dir") {
+                out_dir = next();
+            } else if (arg == "--pack") {
+                pack_path = next();
+            } else if (arg == "--format") {
+                extension = next();
+            } else if (arg == "--scale") {
+                render_options.scale = stoi(next());
+            } else if (arg == "--border") {
+                render_options.border_width = stoi(next());
+            } else if (arg == "--ecl") {
+                options.ecl = toEcl(next());
+            } else if (arg == "--exact") {
+                options.mask_policy = MaskPolicy::EXACT;
+            } else if (arg == "--threads") {
+                options.threads = stoi(next());
+            } else if (arg == "--block") {
+                options.block_size = stoul(next());
+            } else if (arg == "--checkpoint") {
+                options.checkpoint = next();
+            } else if (arg == "--interval") {
+                options.checkpoint_interval = stoul(next());
+            } else if (arg == "--help" or arg == "-h") {
+                printUsage();
+                return 0;
+            } else if (arg.size() > 1 and arg[0] == '-' and arg != "-") {
+                throw invalid_argument("Unknown option " + arg);
+            } else {
+                input_path = arg;
+            }
+        }
+
+        const ImageFormat format{QrCode::getFormat("." + (extension.empty() ? string{"png"} : extension))};
+
+        ifstream input_file{};
+
+        if (not input_path.empty() and input_path != "-") {
+            input_file.open(input_path, ios::binary);
+
+            if (not input_file) {
+                throw invalid_argument("Cannot open " + input_path);
+            }
+        }
+
+        BatchJob job{input_file.is_open() ? static_cast<istream&>(input_file) : cin, options};
+        BatchSink sink{};
+        shared_ptr<PackWriter> pack{};
+
+        const auto renderer{[format, render_options](const QrCode& code) {
+            return code.render(format, render_options);
+        }};
+
+        if (not out_dir.empty()) {
+            const string suffix{"." + (extension.empty() ? string{"png"} : extension)};
+
+            sink.render = renderer;
+            sink.write = [out_dir, suffix](const BatchItem& item, const QrCode&, const vector<uint8_t>& bytes) {
+                const string path{out_dir + "/" + toFileName(item.key) + suffix};
+                ofstream file{path, ios::binary};
+
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<streamsize>(bytes.size()));
+
+                if (not file) {
+                    throw runtime_error("Cannot write " + path);
+                }
+            };
+        } else if (not pack_path.empty()) {
+            /* Resumed jobs keep the entries of the interrupted run */
+            pack = make_shared<PackWriter>(pack_path, MatrixEncoding::AUTO, job.getCheckpoint() > 0);
+
+            if (not extension.empty()) {
+                sink.render = renderer;
+            }
+
+            sink.write = [pack](const BatchItem& item, const QrCode& code, const vector<uint8_t>& bytes) {
+                pack->add(item.key, code, bytes);
+            };
+            sink.flush = [pack]() {
+                pack->flush();
+            };
+        } else {
+            sink.render = [](const QrCode& code) {
+                return SymbolRecord{code}.toBytes();
+            };
+            sink.write = [](const BatchItem& item, const QrCode& code, const vector<uint8_t>& bytes) {
+                static const char DIGITS[]{"0123456789abcdef"};
+                string hex{};
+
+                for (uint8_t byte: bytes) {
+                    hex += DIGITS[byte >> 4];
+                    hex += DIGITS[byte & 0xF];
+                }
+
+                cout << "{\"id\":" << toJson(item.key) << ",\"version\":" << code.getVersion()
+                     << ",\"ecl\":\"" << code.getEcl() << "\",\"mask\":" << code.getMask()
+                     << ",\"record\":\"" << hex << "\"}\n";
+            };
+            sink.flush = []() {
+                cout.flush();
+            };
+        }
+
+        const BatchJob::Stats stats{job.run(sink)};
+
+        if (pack) {
+            pack->close();
+        }
+
+        for (size_t i{0}; i < min(stats.errors.size(), size_t{10}); i++) {
+            cerr << "qrio-batch: " << stats.errors[i] << '\n';
+        }
+
+        if (stats.errors.size() > 10) {
+            cerr << "qrio-batch: " << stats.errors.size() - 10 << " more errors\n";
+        }
+
+        cerr << "qrio-batch: " << stats.items << " QR codes from " << stats.lines << " lines ("
+             << stats.skipped << " skipped, " << stats.errors.size() << " errors) in " << stats.seconds
+             << " s, " << stats.getItemsPerSecond() << " codes/s\n"
+             << "qrio-batch: read " << stats.read_seconds << " s, encode " << stats.encode_seconds
+             << " s & render " << stats.render_seconds << " s (worker time), write " << stats.write_seconds
+             << " s" << endl;
+
+        return stats.errors.empty() ? 0 : 2;
+    } catch (const exception& error) {
+        cerr << "qrio-batch: " << error.what() << endl;
+        printUsage();
+
+        return 1;
+    }
+}
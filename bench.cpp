@@ -0,0 +1,557 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Qrio/DataAnalyzer.h"
+#include "Qrio/Encoder.h"
+#include "Qrio/ErrorCorrectionEncoder.h"
+#include "Qrio/Profiler.h"
+#include "Qrio/QrCode.h"
+#include "Qrio/Structurer.h"
+
+using namespace std;
+using namespace Qrio;
+
+/* Payload modes of the benchmark */
+const vector<string> MODES{"numeric", "alphanumeric", "byte", "kanji", "mixed"};
+
+/* Pipeline stages timed separately */
+const vector<string> STAGES{"data_analyzer", "encoder", "error_correction_encoder",
+                            "structurer", "generate_mask", "save"};
+
+
+/*
+ * Pre-Conditions:
+ *      None.
+ *
+ * Post-Conditions:
+ *      Prints the command line usage.
+ */
+void printUsage() {
+    cerr << "Usage: qrio_bench [options]\n"
+            "Times each pipeline stage over versions, ECLs & payload modes, compares the masks chosen\n"
+            "by MaskPolicy::FAST & EXACT (agreement & penalty regret), then the thread scaling\n"
+            "of batch encoding, & writes the results as JSON.\n"
+            "\n"
+            "Options:\n"
+            "  --versions <a-b>      range of versions (default 1-40)\n"
+            "  --ecl <levels>        error correction levels, e.g. LH (default LMQH)\n"
+            "  --modes <list>        comma separated numeric, alphanumeric, byte, kanji, mixed (default all)\n"
+            "  --iterations <n>      samples per version, ECL & mode (default 10)\n"
+            "  --fast                estimate the mask penalties (MaskPolicy::FAST)\n"
+            "  --threads <n>         maximum threads of the scaling curve (default the hardware concurrency)\n"
+            "  --batch <n>           QR codes encoded per point of the scaling curve (default 1000)\n"
+            "  --output <file>       JSON output file (default the standard output)\n"
+            "\n"
+            "Builds with QRIO_WITH_HEAP_PROFILING also report the allocations, peak heap & resident size\n"
+            "of a QR code of each version & ECL, on the longest byte payload.\n";
+}
+
+/*
+ * Pre-Conditions:
+ *      Name of an error correction level.
+ *
+ * Post-Conditions:
+ *      Returns the level, throws an invalid argument exception for unknown names.
+ */
+Ecl toEcl(char name) {
+    switch (name) {
+        case 'L': case 'l':
+            return Ecl::L;
+        case 'M': case 'm':
+            return Ecl::M;
+        case 'Q': case 'q':
+            return Ecl::Q;
+        case 'H': case 'h':
+            return Ecl::H;
+        default:
+            throw invalid_argument(string{"Unknown ECL: "} + name);
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Payload mode,
+ *      number of characters.
+ *
+ * Post-Conditions:
+ *      Returns a payload of the mode with the given length.
+ *      Kanji characters are given as Shift JIS values.
+ */
+wstring getPayload(const string& mode, size_t length) {
+    static const wstring ALPHANUMERIC{L"QRIO BENCH $%*+-./:"};
+    static const wstring MIXED{L"20261018 QRIO-BENCH \x935F\x89D7 https://example.com/p?id=4711 "};
+    wstring result(length, L'0');
+
+    for (size_t i{0}; i < length; i++) {
+        if (mode == "numeric") {
+            result[i] = static_cast<wchar_t>(L'0' + i % 10);
+        } else if (mode == "alphanumeric") {
+            result[i] = ALPHANUMERIC[i % ALPHANUMERIC.size()];
+        } else if (mode == "byte") {
+            result[i] = static_cast<wchar_t>(L'a' + i % 26);
+        } else if (mode == "kanji") {
+            result[i] = static_cast<wchar_t>(0x8940 + i % 0x3F);
+        } else if (mode == "mixed") {
+            result[i] = MIXED[i % MIXED.size()];
+        } else {
+            throw invalid_argument("Unknown mode: " + mode);
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      Payload,
+ *      version,
+ *      ECL.
+ *
+ * Post-Conditions:
+ *      Returns true iff the payload fits the version at the ECL.
+ */
+bool fits(const wstring& payload, int version, Ecl ecl) {
+    try {
+        const Encoder encoder{DataAnalyzer{payload, version, ecl}};
+
+        return true;
+    } catch (const exception&) {
+        return false;
+    }
+}
+
+/*
+ * Pre-Conditions:
+ *      Payload mode,
+ *      version,
+ *      ECL.
+ *
+ * Post-Conditions:
+ *      Returns the longest payload of the mode which fits the version at the ECL.
+ */
+wstring getLongestPayload(const string& mode, int version, Ecl ecl) {
+    /* Numeric capacity of version 40-L bounds every mode */
+    size_t low{1}, high{7089};
+
+    while (low < high) {
+        const size_t mid{(low + high + 1) / 2};
+
+        if (fits(getPayload(mode, mid), version, ecl)) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return getPayload(mode, low);
+}
+
+/*
+ * Pre-Conditions:
+ *      Start of the measure.
+ *
+ * Post-Conditions:
+ *      Returns the nanoseconds elapsed since the start & restarts the measure.
+ */
+double lap(chrono::steady_clock::time_point& start) {
+    const auto now{chrono::steady_clock::now()};
+    const double result{static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(now - start).count())};
+
+    start = now;
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      Non empty samples.
+ *
+ * Post-Conditions:
+ *      Returns the JSON object of the mean & the 50th, 90th & 99th percentiles in nanoseconds.
+ */
+string toJson(vector<double> samples) {
+    sort(samples.begin(), samples.end());
+
+    double sum{0};
+
+    for (double sample: samples) {
+        sum += sample;
+    }
+
+    const auto percentile{[&](double p) {
+        return static_cast<long long>(samples[static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5)]);
+    }};
+
+    return "{\"mean_ns\":" + to_string(static_cast<long long>(sum / static_cast<double>(samples.size())))
+           + ",\"p50_ns\":" + to_string(percentile(0.5)) + ",\"p90_ns\":" + to_string(percentile(0.9))
+           + ",\"p99_ns\":" + to_string(percentile(0.99)) + "}";
+}
+
+/*
+ * Pre-Conditions:
+ *      Payload,
+ *      version,
+ *      ECL,
+ *      mask policy,
+ *      samples of each stage, in the order of STAGES.
+ *
+ * Post-Conditions:
+ *      Adds one sample of each stage. The mask search is the time of a Structurer
+ *      with an automatic mask minus the one with a fixed mask, & save renders the
+ *      PNG in memory so the filesystem does not skew the results.
+ */
+void sample(const wstring& payload, int version, Ecl ecl, MaskPolicy policy, vector<vector<double>>& samples) {
+    auto start{chrono::steady_clock::now()};
+
+    const DataAnalyzer analyzer{payload, version, ecl};
+    samples[0].push_back(lap(start));
+
+    const Encoder encoder{analyzer};
+    samples[1].push_back(lap(start));
+
+    const ErrorCorrectionEncoder ec_encoder{encoder};
+    samples[2].push_back(lap(start));
+
+    const Structurer fixed{ec_encoder, 0};
+    const double structure{lap(start)};
+    samples[3].push_back(structure);
+
+    const Structurer automatic{ec_encoder, -1, policy};
+    samples[4].push_back(max(0.0, lap(start) - structure));
+
+    const QrCode code{payload, ecl, Designator::TERMINATOR, version, automatic.final_mask};
+    start = chrono::steady_clock::now();
+
+    const vector<uint8_t> png{code.render(ImageFormat::PNG)};
+    samples[5].push_back(lap(start));
+}
+
+/*
+ * Pre-Conditions:
+ *      Number of threads,
+ *      number of QR codes,
+ *      payload,
+ *      ECL,
+ *      mask policy.
+ *
+ * Post-Conditions:
+ *      Returns the wall time in seconds of encoding the QR codes split over the threads.
+ */
+double runBatch(int threads, size_t count, const wstring& payload, Ecl ecl, MaskPolicy policy) {
+    const auto start{chrono::steady_clock::now()};
+    vector<future<void>> workers{};
+
+    for (int t{0}; t < threads; t++) {
+        const size_t first{count * t / threads}, last{count * (t + 1) / threads};
+
+        workers.push_back(async(launch::async, [=, &payload]() {
+            for (size_t i{first}; i < last; i++) {
+                const QrCode code{payload, ecl, Designator::TERMINATOR, -1, -1, 0, -1, -1, policy};
+            }
+        }));
+    }
+
+    for (future<void>& worker: workers) {
+        worker.get();
+    }
+
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+
+#ifdef QRIO_HEAP_PROFILING
+/*
+ * Pre-Conditions:
+ *      JSON output,
+ *      payload,
+ *      version,
+ *      ECL,
+ *      mask policy.
+ *
+ * Post-Conditions:
+ *      Writes the JSON object of the allocations & peak heap of one QrCode construction,
+ *      per stage & in total (the object itself & the pipeline copies included),
+ *      & the heap kept by the finished QrCode.
+ */
+void writeMemory(ostream& output, const wstring& payload, int version, Ecl ecl, MaskPolicy policy) {
+    Profiler::reset();
+
+    const int64_t heap{Profiler::getThreadHeapSize()}, peak{Profiler::getPeakHeapSize()};
+    const uint64_t allocations{Profiler::getThreadAllocations()}, bytes{Profiler::getThreadBytes()};
+
+    const auto code{make_unique<QrCode>(payload, ecl, Designator::TERMINATOR, version, -1, 0, -1, -1, policy)};
+    const StageProfile profile{code->getProfile()};
+
+    output << "{\"version\":" << version << ",\"ecl\":\"" << ecl << "\",\"sizeof\":" << sizeof(QrCode)
+           << ",\"resident_bytes\":" << Profiler::getThreadHeapSize() - heap
+           << ",\"allocations\":" << Profiler::getThreadAllocations() - allocations
+           << ",\"bytes\":" << Profiler::getThreadBytes() - bytes
+           << ",\"peak_bytes\":" << Profiler::getPeakHeapSize() - peak << ",\"stages\":{";
+
+    /* Construction stages only */
+    for (size_t s{0}; s <= static_cast<size_t>(Stage::MASK_SEARCH); s++) {
+        output << (s == 0 ? "\"" : ",\"") << Profiler::getName(static_cast<Stage>(s))
+               << "\":{\"allocations\":" << profile.allocations[s] << ",\"bytes\":" << profile.bytes[s]
+               << ",\"peak_bytes\":" << profile.peak_bytes[s] << '}';
+    }
+
+    output << "}}";
+}
+#endif
+
+
+int main(int argc, const char* argv[]) {
+    int min_version{1}, max_version{40}, iterations{10},
+        max_threads{static_cast<int>(max(1u, thread::hardware_concurrency()))};
+    size_t batch{1000};
+    string levels{"LMQH"}, output_path{};
+    vector<string> modes{MODES};
+    MaskPolicy policy{MaskPolicy::EXACT};
+
+    try {
+        for (int i{1}; i < argc; i++) {
+            const string arg{argv[i]};
+
+            const auto next{[&]() {
+                if (i + 1 >= argc) {
+                    throw invalid_argument("Missing value after " + arg);
+                }
+
+                return string{argv[++i]};
+            }};
+
+            if (arg == "--versions") {
+                const string range{next()};
+                const size_t dash{range.find('-')};
+
+                min_version = stoi(range.substr(0, dash));
+                max_version = dash == string::npos ? min_version : stoi(range.substr(dash + 1));
+            } else if (arg == "--ecl") {
+                levels = next();
+            } else if (arg == "--modes") {
+                const string list{next()};
+
+                modes.clear();
+
+                for (size_t begin{0}, end; begin <= list.size(); begin = end + 1) {
+                    end = min(list.find(',', begin), list.size());
+                    modes.push_back(list.substr(begin, end - begin));
+                }
+            } else if (arg == "--iterations") {
+                iterations = stoi(next());
+            } else if (arg == "--fast") {
+                policy = MaskPolicy::FAST;
+            } else if (arg == "--threads") {
+                max_threads = stoi(next());
+            } else if (arg == "--batch") {
+                batch = stoul(next());
+            } else if (arg == "--output") {
+                output_path = next();
+            } else if (arg == "--help" or arg == "-h") {
+                printUsage();
+                return 0;
+            } else {
+                throw invalid_argument("Unknown option " + arg);
+            }
+        }
+
+        if (min_version < DataAnalyzer::MIN_VERSION or DataAnalyzer::MAX_VERSION < max_version
+            or max_version < min_version) {
+            throw invalid_argument("Versions must be a range within 1-40");
+        }
+
+        if (iterations < 1 or max_threads < 1 or batch < 1) {
+            throw invalid_argument("Iterations, threads & batch must be positive");
+        }
+
+        for (const string& mode: modes) {
+            if (find(MODES.begin(), MODES.end(), mode) == MODES.end()) {
+                throw invalid_argument("Unknown mode: " + mode);
+            }
+        }
+
+        for (char level: levels) {
+            static_cast<void>(toEcl(level));
+        }
+
+        ofstream output_file{};
+
+        if (not output_path.empty()) {
+            output_file.open(output_path);
+
+            if (not output_file) {
+                throw invalid_argument("Cannot open " + output_path);
+            }
+        }
+
+        ostream& output{output_file.is_open() ? static_cast<ostream&>(output_file) : cout};
+
+        output << "{\"iterations\":" << iterations << ",\"mask_policy\":\""
+               << (policy == MaskPolicy::FAST ? "fast" : "exact") << "\",\"results\":[";
+
+        bool first{true};
+        int comparisons{0}, agreements{0};
+        double regret_sum{0}, max_regret{0};
+
+        for (const string& mode: modes) {
+            for (char level: levels) {
+                const Ecl ecl{toEcl(level)};
+
+                for (int version{min_version}; version <= max_version; version++) {
+                    const wstring payload{getLongestPayload(mode, version, ecl)};
+                    vector<vector<double>> samples(STAGES.size());
+                    vector<double> totals{};
+
+                    for (int i{0}; i < iterations; i++) {
+                        sample(payload, version, ecl, policy, samples);
+
+                        double total{0};
+
+                        for (const vector<double>& stage: samples) {
+                            total += stage.back();
+                        }
+
+                        totals.push_back(total);
+                    }
+
+                    output << (first ? "" : ",") << "\n{\"mode\":\"" << mode << "\",\"ecl\":\"" << ecl
+                           << "\",\"version\":" << version << ",\"length\":" << payload.size() << ",\"stages\":{";
+
+                    for (size_t s{0}; s < STAGES.size(); s++) {
+                        output << (s == 0 ? "" : ",") << '"' << STAGES[s] << "\":" << toJson(samples[s]);
+                    }
+
+                    double sum{0};
+
+                    for (double total: totals) {
+                        sum += total;
+                    }
+
+                    /* Mask chosen by FAST against EXACT, & the penalty given up for the speed */
+                    const ErrorCorrectionEncoder ec_encoder{Encoder{DataAnalyzer{payload, version, ecl}}};
+                    Structurer exact{ec_encoder, -1, MaskPolicy::EXACT}, fast{ec_encoder, -1, MaskPolicy::FAST};
+                    const long exact_penalty{exact.getMaskPenalty()}, regret{fast.getMaskPenalty() - exact_penalty};
+
+                    comparisons++;
+                    agreements += exact.final_mask == fast.final_mask;
+                    regret_sum += static_cast<double>(regret) / static_cast<double>(exact_penalty);
+                    max_regret = max(max_regret, static_cast<double>(regret) / static_cast<double>(exact_penalty));
+
+                    output << "},\"total\":" << toJson(totals) << ",\"symbols_per_second\":"
+                           << (sum > 0 ? static_cast<double>(totals.size()) * 1e9 / sum : 0)
+                           << ",\"mask\":{\"exact\":" << exact.final_mask << ",\"fast\":" << fast.final_mask
+                           << ",\"exact_penalty\":" << exact_penalty << ",\"fast_regret\":" << regret << "}}";
+                    first = false;
+
+                    cerr << "qrio_bench: " << mode << ' ' << version << '-' << ecl << '\n';
+                }
+            }
+        }
+
+        /* Penalty regrets are relative to the EXACT penalty */
+        output << "\n],\"mask_comparison\":{\"symbols\":" << comparisons << ",\"agreement\":"
+               << (comparisons > 0 ? static_cast<double>(agreements) / comparisons : 0)
+               << ",\"mean_regret\":" << (comparisons > 0 ? regret_sum / comparisons : 0)
+               << ",\"max_regret\":" << max_regret << '}';
+
+        /* Thread scaling of whole QR codes, on a version 10-M byte payload */
+        const wstring scaling_payload{getLongestPayload("byte", 10, Ecl::M)};
+        double single{0};
+
+        output << ",\"scaling\":{\"version\":10,\"ecl\":\"M\",\"mode\":\"byte\",\"symbols\":" << batch
+               << ",\"points\":[";
+
+        /* Powers of two, then the maximum */
+        for (int threads{1}; ; threads = min(threads * 2, max_threads)) {
+            const double seconds{runBatch(threads, batch, scaling_payload, Ecl::M, policy)};
+
+            if (threads == 1) {
+                single = seconds;
+            }
+
+            output << (threads == 1 ? "" : ",") << "\n{\"threads\":" << threads << ",\"seconds\":" << seconds
+                   << ",\"symbols_per_second\":" << static_cast<double>(batch) / seconds
+                   << ",\"speedup\":" << single / seconds << '}';
+
+            cerr << "qrio_bench: " << threads << " threads\n";
+
+            if (threads == max_threads) {
+                break;
+            }
+        }
+
+        output << "\n]}";
+
+#ifdef QRIO_PROFILING
+        /* Stages recorded by the instrumentation over the whole run */
+        const StageProfile profile{Profiler::getTotal()};
+
+        output << ",\"profile\":{\"symbols\":" << profile.symbols << ",\"probes\":" << profile.probes;
+
+        for (size_t s{0}; s < STAGE_COUNT; s++) {
+            output << ",\"" << Profiler::getName(static_cast<Stage>(s)) << "\":{\"calls\":" << profile.calls[s]
+                   << ",\"ns\":" << profile.nanoseconds[s] << ",\"allocations\":" << profile.allocations[s]
+                   << ",\"bytes\":" << profile.bytes[s] << ",\"peak_bytes\":" << profile.peak_bytes[s] << '}';
+        }
+
+        output << '}';
+#endif
+
+#ifdef QRIO_HEAP_PROFILING
+        output << ",\"memory\":[";
+        first = true;
+
+        for (char level: levels) {
+            const Ecl ecl{toEcl(level)};
+
+            for (int version{min_version}; version <= max_version; version++) {
+                output << (first ? "" : ",") << '\n';
+                writeMemory(output, getLongestPayload("byte", version, ecl), version, ecl, policy);
+                first = false;
+            }
+        }
+
+        output << "\n]";
+#endif
+
+        output << "}\n";
+
+        return 0;
+    } catch (const exception& error) {
+        cerr << "qrio_bench: " << error.what() << endl;
+        printUsage();
+
+        return 1;
+    }
+}
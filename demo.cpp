@@ -23,9 +23,17 @@
 
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "Qrio/FountainDecoder.h"
+#include "Qrio/FrameStream.h"
+#include "Qrio/LabelSheet.h"
+#include "Qrio/PackReader.h"
+#include "Qrio/PackWriter.h"
+#include "Qrio/QrCache.h"
 #include "Qrio/QrCode.h"
-#include "opencv2/opencv.hpp"
+#include "Qrio/SymbolRecord.h"
 
 using namespace std;
 using namespace Qrio;
@@ -126,6 +134,10 @@ int main() {
     /* ECI */
     QrCode qrw_3{wstr_3};
 
+    /* Pre-segmented data, no analysis is performed */
+    QrCode qrs_0{SegmentList{{Designator::NUMERIC, L"12345678901234567890"},
+                             {Designator::ALPHANUMERIC, L"-BIN A7"}}, Ecl::M};
+
     /* Others */
     QrCode qr_0{str_0};
     QrCode qr_1{str_1};
@@ -158,6 +170,7 @@ int main() {
     qrw_2.save("qrw_2.png");
     qrw_2A.save("qrw_2A.png");
     qrw_3.save("qrw_3.png");
+    qrs_0.save("qrs_0.png");
     qr_0.save("qr_0.png");
     qr_1.save("qr_1.png");
     qr_2.save("qr_2.png");
@@ -168,5 +181,113 @@ int main() {
         qrs[i].save("qrsap_" + to_string(i) + ".png");
     }
 
+    /* Automatic structured append, at most version 10 per QR code */
+    const auto& auto_qrs{QrCode::splitStructured(wstr_1, Ecl::M, 10)};
+
+    for (size_t i{0}; i < auto_qrs.size(); i++) {
+        auto_qrs[i].save("qrsap_auto_" + to_string(i) + ".png");
+    }
+
+    /* Micro QR code (M1) for a short numeric ID, 2 modules of quiet zone */
+    const auto& micro{QrCode::makeMicro("12345")};
+    micro.save("qrm_0.png", 10, 2);
+
+    /* Unicode text, the Japanese characters are encoded in Kanji mode */
+    const auto& unicode{QrCode::fromUnicode(L"東京都千代田区 Chiyoda", Ecl::M)};
+    unicode.save("qru_0.png");
+
+    /* GS1 element string (GTIN, expiry, batch), FNC1 is added automatically */
+    const auto& gs1{QrCode::makeGs1(L"(01)09501101530003(17)260101(10)AB-123")};
+    gs1.save("qrg_0.png");
+
+    /* Repeated requests are served from the cache, skipping the encoding */
+    QrCache cache{1 << 20};
+    const auto& cached{cache.get(QrCache::Key{"https://github.com/YamanSD/QR-IO", Ecl::M})};
+    cached->save("qrc_0.png");
+
+    /* PNG bytes in memory, e.g. for an HTTP response, no file is written */
+    RenderOptions options{};
+    options.scale = 4;
+    options.png_compression = 9;
+    options.png_strategy = PngStrategy::RLE;
+    const vector<uint8_t> png{cached->render(ImageFormat::PNG, options)};
+
+    /* Vector artwork for print, 2pt modules */
+    options.scale = 2;
+    const vector<uint8_t> pdf{cached->render(ImageFormat::PDF, options)};
+
+    /* 1 bit portable bitmap, the smallest uncompressed output */
+    cached->save("qrc_0.pbm", 4);
+
+    /* ZPL label for a thermal printer, 6 dots per module */
+    cached->save("qrc_0.zpl", 6);
+
+    /* Compact geometry for storage, reloaded & rendered without re-encoding */
+    const vector<uint8_t> record{SymbolRecord{*cached}.toBytes()};
+    const SymbolRecord loaded{record.data(), record.size()};
+    const RunList runs{SymbolRecord::getRuns(loaded.matrix)};
+
+    cout << "Stored record: " << record.size() << " bytes, first row runs: " << runs.front().size() << endl;
+
+    /* Sheet of 40 asset labels, 5 per row, encoded & rendered in parallel */
+    vector<wstring> labels{};
+
+    for (int i{0}; i < 40; i++) {
+        labels.push_back(L"ASSET-" + to_wstring(1000 + i));
+    }
+
+    SheetLayout layout{};
+    layout.columns = 5;
+
+    LabelSheet sheet{labels, layout, RenderOptions{}, Ecl::M};
+    sheet.save("qrl_0.png");
+
+    /* Animated transfer of a blob larger than structured append allows, one PNG per frame */
+    const string blob(20'000, '*');
+    const FrameStream frames{reinterpret_cast<const uint8_t*>(blob.data()), blob.size()};
+    const FrameStream::Stats stats{frames.saveImages("qrf_")};
+
+    cout << stats.frames << " frames at " << stats.getBytesPerSecond() << " bytes/s" << endl;
+
+    /* Fountain coded transfer, every fifth frame lost on the way */
+    FrameOptions fountain_options{};
+    fountain_options.fountain = true;
+
+    const FrameStream fountain{reinterpret_cast<const uint8_t*>(blob.data()), blob.size(), fountain_options};
+    FountainDecoder receiver{};
+
+    for (size_t i{0}; i < fountain.getFrameCount() and not receiver.isComplete(); i++) {
+        if (i % 5 != 4) {
+            receiver.add(fountain.getPacket(i));
+        }
+    }
+
+    cout << "Fountain stream: " << (receiver.isComplete() ? "recovered" : "incomplete") << " from "
+         << receiver.getReceived() << " of " << fountain.getFrameCount() << " frames" << endl;
+
+    /* Catalog of pre-generated symbols in one pack file, looked up through a memory mapping */
+    vector<pair<string, wstring>> catalog{};
+
+    for (int i{0}; i < 100; i++) {
+        catalog.emplace_back("SKU-" + to_string(i), L"https://example.com/p/" + to_wstring(i));
+    }
+
+    PackWriter pack_writer{"qrp_0.pack"};
+    pack_writer.addAll(catalog, Ecl::M);
+    pack_writer.close();
+
+    const PackReader pack{"qrp_0.pack"};
+    const PackReader::Entry entry{pack.find("SKU-42")};
+
+    cout << "Pack: " << pack.size() << " symbols, SKU-42 is version " << entry.getRecord().version << endl;
+
+    /* Shelf tag price update, only the changed rectangles are redrawn on the e-paper */
+    const QrCode tag_before{L"PRICE 4.99 SKU 123456", Ecl::M};
+    const QrCode tag_after{QrCode::fromPrevious(tag_before, L"PRICE 5.49 SKU 123456")};
+    RenderOptions tag_options{};
+    tag_options.scale = 4;
+
+    cout << "Shelf tag: " << tag_after.getDirtyRegions(tag_before, tag_options).size() << " regions to redraw" << endl;
+
     return 0;
 }
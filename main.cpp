@@ -1,10 +1,10 @@
 #include <iostream>
 #include <ctime>
 #include <opencv2/opencv.hpp>
-#include "../Header/ImageBinarization.hpp"
-#include "../Header/Filesystem.hpp"
-#include "../Header/Generator.hpp"
-#include "../Header/CodeFinder.hpp"
+#include "Qrio/ImageBinarization.hpp"
+#include "Qrio/Filesystem.hpp"
+#include "Qrio/Generator.hpp"
+#include "Qrio/CodeFinder.hpp"
 
 using namespace std;
 using namespace cv;
@@ -273,7 +273,7 @@ float evaluate(const string &source, const Mat &outputImage) {
 	try
 	{
 		groundTruthImage = FileSystem::loadImage(groundTruthImagePath);
-		cvtColor(groundTruthImage, groundTruthImage, CV_BGR2GRAY);
+		cvtColor(groundTruthImage, groundTruthImage, COLOR_BGR2GRAY);
 	}
 	catch (...)
 	{
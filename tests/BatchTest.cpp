@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/BatchJob.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    const string checkpoint{"batch_test.checkpoint"};
+    const string input{"first\n{\"id\": \"second\", \"data\": \"2\", \"ecl\": \"H\"}\nthird\n"};
+    BatchOptions options{};
+    vector<string> keys{};
+    BatchSink sink{};
+
+    options.threads = 2;
+    options.block_size = 2;
+    options.checkpoint = checkpoint;
+    options.checkpoint_interval = 1;
+    sink.write = [&keys](const BatchItem& item, const QrCode&, const vector<uint8_t>&) {
+        keys.push_back(item.key);
+    };
+
+    filesystem::remove(checkpoint);
+
+    /* The checkpoint is replaced after each block, no temporary file is left behind */
+    {
+        istringstream stream{input};
+        BatchJob job{stream, options};
+
+        CHECK(job.getCheckpoint() == 0);
+
+        const BatchJob::Stats stats{job.run(sink)};
+
+        CHECK(stats.items == 3 and stats.skipped == 0 and stats.errors.empty());
+        CHECK((keys == vector<string>{"1", "second", "3"}));
+        CHECK(job.getCheckpoint() == 3);
+        CHECK(not filesystem::exists(checkpoint + ".tmp"));
+
+        ifstream file{checkpoint};
+
+        CHECK(string(istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}) == "QRIO_BATCH 1\n3\n");
+    }
+
+    /* A resumed job skips the lines done */
+    {
+        istringstream stream{input + "fourth\n"};
+        BatchJob job{stream, options};
+
+        keys.clear();
+
+        const BatchJob::Stats stats{job.run(sink)};
+
+        CHECK(stats.skipped == 3 and stats.items == 1);
+        CHECK((keys == vector<string>{"4"}));
+        CHECK(job.getCheckpoint() == 4);
+    }
+
+    filesystem::remove(checkpoint);
+
+    /* A checkpoint which cannot be created stops the job */
+    {
+        istringstream stream{input};
+
+        options.checkpoint = "missing_directory/batch_test.checkpoint";
+
+        BatchJob job{stream, options};
+
+        CHECK_THROWS(job.run(sink), invalid_argument);
+    }
+
+    return Tests::report();
+}
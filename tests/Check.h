@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QR_IO_TESTS_CHECK_H
+#define QR_IO_TESTS_CHECK_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/* Records a failure with its location if the condition is false */
+#define CHECK(condition) Qrio::Tests::check((condition), #condition, __FILE__, __LINE__)
+
+/* Records a failure if the expression does not throw the exception type */
+#define CHECK_THROWS(expression, type) do {                                              \
+        bool thrown{false};                                                              \
+        try { static_cast<void>(expression); } catch (const type&) { thrown = true; }    \
+        Qrio::Tests::check(thrown, #expression " throws " #type, __FILE__, __LINE__);    \
+    } while (false)
+
+
+namespace Qrio::Tests {
+    /* Number of failed checks */
+    inline int failures{0};
+
+    /*
+     * Pre-Conditions:
+     *      Result of the check,
+     *      text of the check,
+     *      file & line of the check.
+     *
+     * Post-Conditions:
+     *      Counts & prints the check if it failed.
+     */
+    inline void check(bool passed, const char* text, const char* file, int line) {
+        if (not passed) {
+            failures++;
+            std::cerr << file << ':' << line << ": check failed: " << text << '\n';
+        }
+    }
+
+    /*
+     * Pre-Conditions:
+     *      None.
+     *
+     * Post-Conditions:
+     *      Returns the exit code of the test, 0 iff every check passed.
+     */
+    inline int report() {
+        if (failures != 0) {
+            std::cerr << failures << " checks failed\n";
+        }
+
+        return failures == 0 ? 0 : 1;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Bytes,
+     *      optional upper case (default lower case).
+     *
+     * Post-Conditions:
+     *      Returns the hexadecimal digits of the bytes.
+     */
+    inline std::string toHex(const std::vector<uint8_t>& bytes, bool upper = false) {
+        const char* digits{upper ? "0123456789ABCDEF" : "0123456789abcdef"};
+        std::string result{};
+
+        for (uint8_t byte: bytes) {
+            result += digits[byte >> 4];
+            result += digits[byte & 0xF];
+        }
+
+        return result;
+    }
+
+    /*
+     * Pre-Conditions:
+     *      Text.
+     *
+     * Post-Conditions:
+     *      Returns the bytes of the text.
+     */
+    inline std::vector<uint8_t> toBytes(const std::string& text) {
+        return {text.begin(), text.end()};
+    }
+}
+
+
+#endif //QR_IO_TESTS_CHECK_H
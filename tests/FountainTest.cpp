@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Qrio/FountainDecoder.h"
+#include "Qrio/FountainEncoder.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Packet.
+ *
+ * Post-Conditions:
+ *      Returns the packet after a trip through its frame bytes.
+ */
+static FramePacket transmit(const FramePacket& packet) {
+    const vector<uint8_t> bytes{packet.toBytes()};
+
+    return FramePacket{bytes.data(), bytes.size()};
+}
+
+/*
+ * Pre-Conditions:
+ *      Data,
+ *      chunk size in bytes,
+ *      index of the chunk.
+ *
+ * Post-Conditions:
+ *      Returns the chunk packet of the data, the last one is not padded.
+ */
+static FramePacket getChunk(const vector<uint8_t>& data, size_t chunk_size, uint32_t index) {
+    FramePacket result{};
+    const size_t start{index * chunk_size};
+    const size_t end{min(start + chunk_size, data.size())};
+
+    result.type = PacketType::CHUNK;
+    result.sequence = index;
+    result.count = static_cast<uint32_t>((data.size() + chunk_size - 1) / chunk_size);
+    result.file_size = static_cast<uint32_t>(data.size());
+    result.payload.assign(data.begin() + static_cast<ptrdiff_t>(start), data.begin() + static_cast<ptrdiff_t>(end));
+
+    return result;
+}
+
+int main() {
+    /* 1000 bytes in 64 byte chunks, the last of the 16 chunks is 40 bytes long */
+    vector<uint8_t> data(1000);
+
+    for (size_t i{0}; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+
+    const FountainEncoder encoder{data.data(), data.size(), 64};
+
+    CHECK(encoder.getChunkCount() == 16);
+
+    /* The first k seeds are the chunks themselves */
+    {
+        FountainDecoder decoder{};
+
+        for (uint32_t seed{0}; seed < 16; seed++) {
+            CHECK(decoder.add(transmit(encoder.getPacket(seed))) == (seed == 15));
+        }
+
+        CHECK(decoder.getRecovered() == 16);
+        CHECK(decoder.getData() == data);
+    }
+
+    /* A third of the systematic frames lost, the gap is filled by later symbols */
+    {
+        FountainDecoder decoder{};
+        uint32_t seed{0};
+
+        for (; seed < 200 and not decoder.isComplete(); seed++) {
+            if (seed < 16 and seed % 3 == 0) {
+                continue;
+            }
+
+            decoder.add(transmit(encoder.getPacket(seed)));
+
+            /* Duplicates are harmless */
+            if (seed % 5 == 0) {
+                decoder.add(transmit(encoder.getPacket(seed)));
+            }
+        }
+
+        CHECK(decoder.isComplete());
+        CHECK(seed < 200);
+        CHECK(decoder.getData() == data);
+    }
+
+    /* Only fountain symbols, no systematic frame at all */
+    {
+        FountainDecoder decoder{};
+
+        for (uint32_t seed{16}; seed < 400 and not decoder.isComplete(); seed++) {
+            decoder.add(encoder.getPacket(seed));
+        }
+
+        CHECK(decoder.isComplete());
+        CHECK(decoder.getData() == data);
+    }
+
+    /* Chunk packets in reverse order, mixed with a fountain symbol */
+    {
+        FountainDecoder decoder{};
+
+        decoder.add(encoder.getPacket(20));
+
+        for (uint32_t index{16}; index-- > 0;) {
+            decoder.add(transmit(getChunk(data, 64, index)));
+        }
+
+        CHECK(decoder.isComplete());
+        CHECK(decoder.getData() == data);
+    }
+
+    /* Incomplete files & packets of other files are rejected */
+    {
+        FountainDecoder decoder{};
+
+        CHECK_THROWS(static_cast<void>(decoder.getData()), domain_error);
+
+        FramePacket empty{encoder.getPacket(3)};
+
+        empty.count = 0;
+        CHECK_THROWS(decoder.add(empty), invalid_argument);
+        CHECK(decoder.getReceived() == 0);
+
+        decoder.add(encoder.getPacket(3));
+        CHECK(not decoder.isComplete());
+        CHECK_THROWS(static_cast<void>(decoder.getData()), domain_error);
+
+        CHECK_THROWS(decoder.add(empty), invalid_argument);
+
+        FramePacket other{encoder.getPacket(4)};
+
+        other.count = 17;
+        CHECK_THROWS(decoder.add(other), invalid_argument);
+
+        other = encoder.getPacket(4);
+        other.file_size = 1001;
+        CHECK_THROWS(decoder.add(other), invalid_argument);
+
+        other = encoder.getPacket(40);
+        decoder.add(other);
+        other.payload.push_back(0);
+        CHECK_THROWS(decoder.add(other), invalid_argument);
+
+        FramePacket chunk{getChunk(data, 64, 5)};
+
+        chunk.sequence = 16;
+        CHECK_THROWS(decoder.add(chunk), invalid_argument);
+    }
+
+    /* File sizes beyond the chunks are rejected before anything is allocated, the last chunk may be short */
+    {
+        FountainDecoder decoder{};
+        FramePacket symbol{encoder.getPacket(20)}, chunk{getChunk(data, 64, 5)};
+
+        symbol.file_size = 16 * 64 + 1;
+        CHECK_THROWS(decoder.add(symbol), invalid_argument);
+
+        chunk.file_size = 0xFFFFFFFF;
+        CHECK_THROWS(decoder.add(chunk), invalid_argument);
+        CHECK(decoder.getReceived() == 0);
+
+        chunk = getChunk(data, 64, 0);
+        chunk.count = 1;
+        CHECK_THROWS(decoder.add(chunk), invalid_argument);
+
+        decoder.add(getChunk(data, 64, 15));
+        CHECK(decoder.getReceived() == 1);
+
+        for (uint32_t index{0}; index < 15; index++) {
+            decoder.add(getChunk(data, 64, index));
+        }
+
+        CHECK(decoder.getData() == data);
+    }
+
+    return Tests::report();
+}
@@ -0,0 +1,180 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/FrameStream.h"
+#include "Qrio/MappedFile.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Path of the file,
+ *      bytes of the file.
+ *
+ * Post-Conditions:
+ *      Writes the file.
+ */
+void writeFile(const string& path, const vector<uint8_t>& bytes) {
+    ofstream file{path, ios::binary};
+
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<streamsize>(bytes.size()));
+}
+
+
+int main() {
+    vector<uint8_t> data(1000);
+
+    for (size_t i{0}; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    /* Packets survive serialization, corrupted ones are rejected */
+    FramePacket packet{};
+
+    packet.sequence = 2;
+    packet.count = 5;
+    packet.file_size = 1000;
+    packet.payload.assign(data.begin(), data.begin() + 200);
+
+    vector<uint8_t> bytes{packet.toBytes()};
+    const FramePacket parsed{bytes.data(), bytes.size()};
+
+    CHECK(bytes.size() == FramePacket::OVERHEAD + 200 and bytes[0] == 'Q' and bytes[1] == 'F');
+    CHECK(parsed.type == PacketType::CHUNK and parsed.sequence == 2 and parsed.count == 5);
+    CHECK(parsed.file_size == 1000 and parsed.payload == packet.payload);
+
+    bytes[FramePacket::OVERHEAD] ^= 0x01;
+    CHECK_THROWS(FramePacket(bytes.data(), bytes.size()), invalid_argument);
+    bytes[FramePacket::OVERHEAD] ^= 0x01;
+    bytes.back() ^= 0x80;
+    CHECK_THROWS(FramePacket(bytes.data(), bytes.size()), invalid_argument);
+    bytes.back() ^= 0x80;
+    CHECK_THROWS(FramePacket(bytes.data(), FramePacket::OVERHEAD - 1), invalid_argument);
+
+    packet.sequence = 5;
+    bytes = packet.toBytes();
+    CHECK_THROWS(FramePacket(bytes.data(), bytes.size()), invalid_argument);
+
+    /* Frames fit a full chunk & its 19 byte overhead: 119 bytes in version 7-M, 419 bytes in version 16-M */
+    const FrameStream small{data.data(), data.size(), FrameOptions{.chunk_size = 100}};
+    const FrameStream large{data.data(), data.size(), FrameOptions{.chunk_size = 400}};
+    const FrameStream exact{data.data(), 800, FrameOptions{.chunk_size = 400}};
+    const FrameStream fountain{data.data(), data.size(), FrameOptions{.chunk_size = 400, .fountain = true}};
+
+    CHECK(small.getFrameCount() == 10 and small.getVersion() == 7);
+    CHECK(large.getFrameCount() == 3 and large.getVersion() == 16);
+    CHECK(exact.getFrameCount() == 2);
+    CHECK(fountain.getFrameCount() == 3 + 2 and fountain.getVersion() == 16);
+
+    /* The last chunk is the remainder of the file */
+    const FramePacket last{large.getPacket(2)};
+
+    CHECK(last.sequence == 2 and last.count == 3 and last.file_size == 1000);
+    CHECK(vector<uint8_t>(data.begin() + 800, data.end()) == last.payload);
+    CHECK_THROWS(FrameStream(data.data(), data.size(), FrameOptions{.chunk_size = 0}), invalid_argument);
+    CHECK_THROWS(FrameStream(data.data(), data.size(), FrameOptions{.redundancy = -1}), invalid_argument);
+
+    /* An empty file still takes one empty frame */
+    const FrameStream empty{data.data(), 0, FrameOptions{.chunk_size = 100}};
+    const FramePacket nothing{empty.getPacket(0)};
+
+    CHECK(empty.getFrameCount() == 1 and empty.getVersion() == 7);
+    CHECK(nothing.count == 1 and nothing.file_size == 0 and nothing.payload.empty());
+
+    /* A window of 2 still delivers every frame in order, the statistics count the payload bytes */
+    const FrameStream windowed{data.data(), data.size(), FrameOptions{.chunk_size = 50, .window = 2}};
+    vector<size_t> order{};
+    bool same{true};
+
+    const FrameStream::Stats stats{windowed.encode([&](size_t index, const QrCode& frame) {
+        order.push_back(index);
+        same = same and frame.render(ImageFormat::PBM) == windowed.getFrame(index).render(ImageFormat::PBM);
+    })};
+
+    CHECK(order.size() == 20 and same);
+
+    for (size_t i{0}; i < order.size(); i++) {
+        CHECK(order[i] == i);
+    }
+
+    CHECK(stats.frames == 20 and stats.bytes == 1000);
+
+    /* Fountain streams count their symbol bytes, a chunk per frame */
+    const FrameStream::Stats fountain_stats{fountain.encode([](size_t, const QrCode&) {})};
+
+    CHECK(fountain_stats.frames == 5 and fountain_stats.bytes == 5 * 400);
+
+    /* Mapped files hold the bytes of the file, empty files have no mapping, missing files are rejected */
+    const string path{"FrameStreamTest.bin"}, empty_path{"FrameStreamTest_empty.bin"};
+
+    writeFile(path, data);
+    writeFile(empty_path, {});
+
+    {
+        const MappedFile file{path};
+        const FrameStream mapped{path, FrameOptions{.chunk_size = 400}};
+
+        CHECK(file.size() == data.size() and vector<uint8_t>(file.data(), file.data() + file.size()) == data);
+        CHECK(mapped.getFrameCount() == 3 and mapped.getPacket(2).payload == last.payload);
+    }
+
+    {
+        const MappedFile file{empty_path};
+        const FrameStream mapped{empty_path};
+
+        CHECK(file.size() == 0 and file.data() == nullptr);
+        CHECK(mapped.getFrameCount() == 1 and mapped.getPacket(0).payload.empty());
+    }
+
+    filesystem::remove(path);
+    filesystem::remove(empty_path);
+
+    CHECK_THROWS(MappedFile{path}, invalid_argument);
+    CHECK_THROWS(FrameStream{path}, invalid_argument);
+
+    /* Images are numbered from 0, a missing directory is reported */
+    const string prefix{"FrameStreamTest_"};
+    const FrameStream::Stats saved{large.saveImages(prefix, RenderOptions{.scale = 1})};
+
+    CHECK(saved.frames == 3);
+
+    for (const char* name: {"000000.png", "000001.png", "000002.png"}) {
+        CHECK(filesystem::exists(prefix + name));
+        filesystem::remove(prefix + name);
+    }
+
+    CHECK(not filesystem::exists(prefix + "000003.png"));
+    CHECK_THROWS(large.saveImages("missing_directory/" + prefix), invalid_argument);
+
+    return Tests::report();
+}
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    const Gs1 gs1{L"(01)09501101530003(10)AB12(21)12345"};
+
+    CHECK(gs1.getElements() == (vector<pair<wstring, wstring>>{{L"01", L"09501101530003"},
+                                                               {L"10", L"AB12"},
+                                                               {L"21", L"12345"}}));
+
+    /* The variable length (10) ends with a group separator, encoded as % in alphanumeric mode */
+    CHECK(gs1.getSegments(2) == (SegmentList{{Designator::NUMERIC, L"010950110153000310"},
+                                             {Designator::ALPHANUMERIC, L"AB12%"},
+                                             {Designator::NUMERIC, L"2112345"}}));
+
+    /* FNC1 (1st position) mode indicator 0101 before the first segment, Check 7.4.8.2 */
+    const Encoder encoder{DataAnalyzer{gs1.getSegments(2), 2, Ecl::L, 1}};
+    const vector<int> codewords{0x51, 0x04, 0x80, 0xAE, 0xD8, 0x6E, 0x26, 0x40, 0x04, 0xD8,
+                                0x80, 0xA7, 0x34, 0x17, 0xCC, 0x20, 0x39, 0xA6, 0x75, 0x28, 0x00};
+
+    CHECK(vector<int>(encoder.codewords.begin(), encoder.codewords.begin() + 21) == codewords);
+
+    /* Explicit segments are validated as given, none is merged or converted */
+    const QrCode explicit_code{gs1.getSegments(2), Ecl::L, 2, -1, 1};
+    const QrCode eci_code{SegmentList{{Designator::ECI, L"26"}, {Designator::BYTE, L"\u00C3\u00A9"}}};
+
+    CHECK(explicit_code.getMatrix() == QrCode::makeGs1(L"(01)09501101530003(10)AB12(21)12345", Ecl::L, 2).getMatrix());
+    CHECK(eci_code.getVersion() == 1);
+
+    CHECK_THROWS(QrCode{SegmentList{}}, invalid_argument);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::NUMERIC, L"12A"}}}), range_error);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::ALPHANUMERIC, L"ab"}}}), range_error);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::KANJI, L"A"}}}), range_error);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::BYTE, L"\u0100"}}}), range_error);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::BYTE, L""}}}), range_error);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::TERMINATOR, L"1"}}}), invalid_argument);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::ECI, L"26"}}}), invalid_argument);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::ECI, L"26"}, {Designator::ECI, L"3"}, {Designator::BYTE, L"a"}}}),
+                 invalid_argument);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::ECI, L"2x"}, {Designator::BYTE, L"a"}}}), invalid_argument);
+    CHECK_THROWS((QrCode{SegmentList{{Designator::NUMERIC, wstring(8000, L'1')}}}), length_error);
+
+    /* Raw element strings need no separator after predefined lengths, nor after the last value */
+    const Gs1 raw{L"0109501101530003" L"10AB12\x1D" L"2112345"};
+
+    CHECK(raw.getElements() == gs1.getElements());
+    CHECK(QrCode::makeGs1(L"(01)09501101530003(10)AB12(21)12345").getMatrix()
+          == QrCode::makeGs1(L"0109501101530003" L"10AB12\x1D" L"2112345").getMatrix());
+
+    /* The last value needs no separator either */
+    CHECK(Gs1{L"(01)09501101530003(17)260101(10)AB-123"}.getSegments(2)
+          == (SegmentList{{Designator::NUMERIC, L"01095011015300031726010110"},
+                          {Designator::ALPHANUMERIC, L"AB-123"}}));
+
+    /* Lower case values fall back to byte mode, with 0x1D as the separator */
+    CHECK(Gs1{L"(10)ab%cd(21)X"}.getSegments(2) == (SegmentList{{Designator::BYTE, L"10ab%cd\x1D" L"21X"}}));
+
+    CHECK_THROWS(Gs1{L""}, invalid_argument);
+    CHECK_THROWS(Gs1{L"(99)"}, invalid_argument);
+    CHECK_THROWS(Gs1{L"(01)123"}, invalid_argument);
+    CHECK_THROWS(Gs1{L"(10)AB~C"}, invalid_argument);
+    CHECK_THROWS(Gs1{L"(01)09501101530003(10"}, invalid_argument);
+    CHECK_THROWS(Gs1{L"(7777)1"}, invalid_argument);
+    CHECK_THROWS(QrCode::makeGs1(L"(01)09501101530003(10)AB~C"), invalid_argument);
+
+    return Tests::report();
+}
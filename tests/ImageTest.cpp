@@ -0,0 +1,349 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef QRIO_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/* Returns true if the pixel at (x, y) of the decoded image is dark */
+typedef function<bool(size_t, size_t)> Image;
+
+/*
+ * Pre-Conditions:
+ *      QR code,
+ *      render options,
+ *      decoded image.
+ *
+ * Post-Conditions:
+ *      Returns true if every pixel of the image matches its module, or the quiet zone.
+ */
+bool matches(const QrCode& code, const RenderOptions& options, const Image& image) {
+    const SquareMatrix& matrix{code.getMatrix()};
+    const size_t border{static_cast<size_t>(options.border_width)}, scale{static_cast<size_t>(options.scale)};
+    const size_t side{(matrix.size() + 2 * border) * scale};
+
+    for (size_t y{0}; y < side; y++) {
+        for (size_t x{0}; x < side; x++) {
+            const size_t row{y / scale}, column{x / scale};
+            const bool inside{border <= row and row < matrix.size() + border
+                              and border <= column and column < matrix.size() + border};
+
+            if (image(x, y) != (inside and matrix.at(row - border, column - border))) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      Bytes,
+ *      offset of the value,
+ *      number of bytes of the value.
+ *
+ * Post-Conditions:
+ *      Returns the little endian value.
+ */
+uint32_t getLittleEndian(const vector<uint8_t>& bytes, size_t offset, int count) {
+    uint32_t result{0};
+
+    for (int i{count - 1}; i >= 0; i--) {
+        result = result << 8 | bytes[offset + i];
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      Bytes,
+ *      offset of the value.
+ *
+ * Post-Conditions:
+ *      Returns the 4 byte big endian value.
+ */
+uint32_t getBigEndian(const vector<uint8_t>& bytes, size_t offset) {
+    return static_cast<uint32_t>(bytes[offset]) << 24 | bytes[offset + 1] << 16
+           | bytes[offset + 2] << 8 | bytes[offset + 3];
+}
+
+/*
+ * Pre-Conditions:
+ *      Packed rows (most significant bit first),
+ *      offset of the first row,
+ *      bytes between the starts of consecutive rows,
+ *      bit value of the dark pixels.
+ *
+ * Post-Conditions:
+ *      Returns the image of the rows.
+ */
+Image getPacked(const vector<uint8_t>& bytes, size_t offset, size_t stride, bool dark_bit) {
+    return [&bytes, offset, stride, dark_bit](size_t x, size_t y) {
+        return ((bytes[offset + y * stride + x / 8] >> (7 - x % 8) & 1) != 0) == dark_bit;
+    };
+}
+
+/*
+ * Pre-Conditions:
+ *      QR code,
+ *      render options.
+ *
+ * Post-Conditions:
+ *      Checks the PNG chunks, inflates the image data & compares it with the matrix.
+ */
+void checkPng(const QrCode& code, const RenderOptions& options, bool palette) {
+    const vector<uint8_t> png{code.render(ImageFormat::PNG, options)};
+    const uint32_t side{static_cast<uint32_t>((code.getMatrix().size() + 2 * options.border_width) * options.scale)};
+
+    CHECK(Tests::toHex(vector<uint8_t>(png.begin(), png.begin() + 8)) == "89504e470d0a1a0a");
+
+    vector<string> types{};
+    vector<uint8_t> idat{};
+
+    for (size_t offset{8}; offset + 12 <= png.size();) {
+        const uint32_t length{getBigEndian(png, offset)};
+        const string type{png.begin() + static_cast<long>(offset) + 4, png.begin() + static_cast<long>(offset) + 8};
+
+        types.push_back(type);
+
+        if (type == "IHDR") {
+            CHECK(getBigEndian(png, offset + 8) == side and getBigEndian(png, offset + 12) == side);
+            CHECK(png[offset + 16] == 1 and png[offset + 17] == (palette ? 3 : 0));
+        } else if (type == "IDAT") {
+            idat.insert(idat.end(), png.begin() + static_cast<long>(offset) + 8,
+                        png.begin() + static_cast<long>(offset + 8 + length));
+        }
+
+#ifdef QRIO_WITH_ZLIB
+        CHECK(getBigEndian(png, offset + 8 + length) == crc32(0, png.data() + offset + 4, length + 4));
+#endif
+
+        offset += 12 + length;
+    }
+
+    CHECK(types.front() == "IHDR" and types.back() == "IEND");
+    CHECK((find(types.begin(), types.end(), "PLTE") != types.end()) == palette);
+
+#ifdef QRIO_WITH_ZLIB
+    /* Filter type 0 before each row */
+    const size_t stride{1 + (side + 7) / 8};
+    vector<uint8_t> raw(stride * side);
+    uLongf raw_size{raw.size()};
+
+    CHECK(uncompress(raw.data(), &raw_size, idat.data(), idat.size()) == Z_OK);
+    CHECK(raw_size == raw.size());
+
+    for (size_t y{0}; y < side; y++) {
+        CHECK(raw[y * stride] == 0);
+    }
+
+    CHECK(matches(code, options, getPacked(raw, 1, stride, palette)));
+#endif
+}
+
+/*
+ * Pre-Conditions:
+ *      Path of a file.
+ *
+ * Post-Conditions:
+ *      Returns the bytes of the file.
+ */
+vector<uint8_t> readFile(const string& path) {
+    ifstream file{path, ios::binary};
+
+    return vector<uint8_t>{istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}};
+}
+
+
+int main() {
+    const QrCode code{"01234567", Ecl::M, Designator::TERMINATOR, 1};
+
+    /* Sides of 75 & 42 pixels, not multiples of 8, colors are in BGR order */
+    const RenderOptions options{.scale = 3, .border_width = 2};
+    const RenderOptions colored{.scale = 2, .border_width = 0,
+                                .light_color = {255, 255, 0}, .dark_color = {0, 0, 128}};
+    const size_t side{75};
+
+    checkPng(code, options, false);
+    checkPng(code, colored, true);
+
+    /* PBM: P4 header, rows padded to bytes, black is 1 */
+    const vector<uint8_t> pbm{code.render(ImageFormat::PBM, options)};
+    const string pbm_header{"P4\n75 75\n"};
+
+    CHECK(string(pbm.begin(), pbm.begin() + static_cast<long>(pbm_header.size())) == pbm_header);
+    CHECK(pbm.size() == pbm_header.size() + 10 * side);
+    CHECK(matches(code, options, getPacked(pbm, pbm_header.size(), 10, true)));
+
+    /* BMP: 1 bit with a 2 color palette, bottom up rows padded to 4 bytes */
+    const vector<uint8_t> bmp{code.render(ImageFormat::BMP, colored)};
+
+    CHECK(bmp[0] == 'B' and bmp[1] == 'M');
+    CHECK(getLittleEndian(bmp, 2, 4) == bmp.size());
+    CHECK(getLittleEndian(bmp, 18, 4) == 42 and getLittleEndian(bmp, 22, 4) == 42);
+    CHECK(getLittleEndian(bmp, 28, 2) == 1);
+    CHECK(getLittleEndian(bmp, 54, 4) == 0x00FFFF and getLittleEndian(bmp, 58, 4) == 0x800000);
+    CHECK(matches(code, colored, [&bmp](size_t x, size_t y) {
+        return getPacked(bmp, getLittleEndian(bmp, 10, 4), 8, true)(x, 41 - y);
+    }));
+
+    /* TIFF: little endian, the single strip after the IFD, WhiteIsZero or palette */
+    for (bool bilevel: {true, false}) {
+        const RenderOptions& tiff_options{bilevel ? options : colored};
+        const vector<uint8_t> tiff{code.render(ImageFormat::TIFF, tiff_options)};
+        const size_t ifd{getLittleEndian(tiff, 4, 4)}, entries{getLittleEndian(tiff, ifd, 2)};
+        const uint32_t tiff_side{static_cast<uint32_t>((21 + 2 * tiff_options.border_width) * tiff_options.scale)};
+        uint32_t strip{0}, strip_size{0}, photometric{9};
+
+        CHECK(tiff[0] == 'I' and tiff[1] == 'I' and getLittleEndian(tiff, 2, 2) == 42);
+
+        for (size_t i{0}; i < entries; i++) {
+            const size_t entry{ifd + 2 + 12 * i};
+            const uint32_t tag{getLittleEndian(tiff, entry, 2)}, value{getLittleEndian(tiff, entry + 8, 4)};
+
+            if (tag == 256 or tag == 257) {
+                CHECK(value == tiff_side);
+            } else if (tag == 262) {
+                photometric = value;
+            } else if (tag == 273) {
+                strip = value;
+            } else if (tag == 279) {
+                strip_size = value;
+            }
+        }
+
+        CHECK(photometric == (bilevel ? 0u : 3u));
+        CHECK(strip_size == (tiff_side + 7) / 8 * tiff_side and strip + strip_size == tiff.size());
+        CHECK(matches(code, tiff_options, getPacked(tiff, strip, (tiff_side + 7) / 8, true)));
+    }
+
+    /* PPM: 3 bytes per pixel in the given colors */
+    const vector<uint8_t> ppm{code.render(ImageFormat::PPM, colored)};
+    const string ppm_header{"P6\n42 42\n255\n"};
+
+    CHECK(string(ppm.begin(), ppm.begin() + static_cast<long>(ppm_header.size())) == ppm_header);
+    CHECK(matches(code, colored, [&ppm, &ppm_header](size_t x, size_t y) {
+        return ppm[ppm_header.size() + (y * 42 + x) * 3] == 128;
+    }));
+
+    /*
+     * Raw buffers: gray, BGR & BGRA pixels match the PPM, drawn one pixel right & down of the start of a region
+     * wider & taller than the QR code, in rows padded past their pixels. Everything else keeps its 0x7F.
+     */
+    for (size_t channels: {1, 3, 4}) {
+        const RenderOptions& raw_options{channels == 1 ? options : colored};
+        const size_t raw_side{(21 + 2 * static_cast<size_t>(raw_options.border_width)) * raw_options.scale};
+        const size_t width{raw_side + 6}, height{raw_side + 4}, stride{width * channels + 5};
+        const vector<uint8_t> reference{code.render(ImageFormat::PPM, raw_options)};
+        const size_t header{("P6\n" + to_string(raw_side) + " " + to_string(raw_side) + "\n255\n").size()};
+        vector<uint8_t> raw(stride * height, 0x7F);
+        size_t mismatches{0};
+
+        code.renderInto(raw.data() + stride + channels, stride, static_cast<int>(width) - 1,
+                        static_cast<int>(height) - 1, channels, raw_options);
+
+        for (size_t y{0}; y < height; y++) {
+            for (size_t i{0}; i < stride; i++) {
+                const size_t x{i / channels}, channel{i % channels};
+                uint8_t expected{0x7F};
+
+                if (1 <= y and y <= raw_side and 1 <= x and x <= raw_side) {
+                    const size_t pixel{header + ((y - 1) * raw_side + x - 1) * 3};
+
+                    /* PPM pixels are RGB, gray pixels are black or white here */
+                    expected = channels == 1 ? reference[pixel] : channel == 3 ? 255 : reference[pixel + 2 - channel];
+                }
+
+                mismatches += raw[y * stride + i] != expected;
+            }
+        }
+
+        CHECK(mismatches == 0);
+    }
+
+    /* Streams give the same bytes */
+    ostringstream stream{};
+
+    code.render(stream, ImageFormat::PNG, options);
+    CHECK(Tests::toBytes(stream.str()) == code.render(ImageFormat::PNG, options));
+
+    /* Invalid scales & borders are rejected by every entry point */
+    vector<uint8_t> pixels(100 * 100, 0x7F);
+
+    for (const RenderOptions& invalid: {RenderOptions{.scale = 0}, RenderOptions{.scale = -2},
+                                        RenderOptions{.border_width = -1}}) {
+        for (ImageFormat format: {ImageFormat::PNG, ImageFormat::BMP, ImageFormat::PBM, ImageFormat::SVG}) {
+            CHECK_THROWS(code.render(format, invalid), invalid_argument);
+            CHECK_THROWS(code.render(stream, format, invalid), invalid_argument);
+        }
+
+        CHECK_THROWS(code.renderInto(pixels.data(), 100, 100, 100, 1, invalid), invalid_argument);
+        CHECK_THROWS(code.getDirtyRegions(code, invalid), invalid_argument);
+    }
+
+    CHECK(pixels == vector<uint8_t>(100 * 100, 0x7F));
+
+    const string path{"ImageTest.png"};
+
+    filesystem::remove(path);
+    CHECK_THROWS(code.save(path, 0), invalid_argument);
+    CHECK_THROWS(code.save(path, 10, -1), invalid_argument);
+    CHECK(not filesystem::exists(path));
+
+    /* Saved files hold the rendered bytes, failures to create or write them are reported */
+    code.save(path, 3, 2);
+    CHECK(readFile(path) == code.render(ImageFormat::PNG, RenderOptions{.scale = 3, .border_width = 2}));
+    filesystem::remove(path);
+
+    CHECK_THROWS(code.save("missing_directory/" + path), invalid_argument);
+
+    if (filesystem::exists("/dev/full")) {
+        const string full{"ImageTest_full.pbm"};
+
+        filesystem::remove(full);
+        filesystem::create_symlink("/dev/full", full);
+        CHECK_THROWS(code.save(full), domain_error);
+        filesystem::remove(full);
+    }
+
+    return Tests::report();
+}
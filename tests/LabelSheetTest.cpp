@@ -0,0 +1,148 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/LabelSheet.h"
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      QR code,
+ *      scale.
+ *
+ * Post-Conditions:
+ *      Returns the number of dark pixels of the QR code at the scale.
+ */
+size_t countDark(const QrCode& code, int scale) {
+    const SquareMatrix& matrix{code.getMatrix()};
+    size_t result{0};
+
+    for (size_t row{0}; row < matrix.size(); row++) {
+        for (size_t column{0}; column < matrix.size(); column++) {
+            result += matrix.at(row, column);
+        }
+    }
+
+    return result * scale * scale;
+}
+
+
+int main() {
+    const vector<wstring> data{L"first", L"second", L"third"};
+    const SheetLayout layout{.columns = 2, .cell_size = 50, .spacing = 5, .margin = 7, .threads = 2};
+    const RenderOptions options{.scale = 2, .border_width = 1};
+
+    /* 2 x 2 cells of 50 pixels, the symbols of (21 + 2) * 2 = 46 pixels are centered 2 pixels into them */
+    const LabelSheet sheet{data, layout, options};
+    const vector<uint8_t>& pixels{sheet.getPixels()};
+    const int width{7 + 50 + 5 + 50 + 7};
+
+    CHECK(sheet.getWidth() == width and sheet.getHeight() == width);
+    CHECK(sheet.getChannels() == 1);
+    CHECK(pixels.size() == static_cast<size_t>(width * width));
+
+    size_t dark{0};
+
+    for (size_t i{0}; i < data.size(); i++) {
+        const int x{7 + static_cast<int>(i % 2) * 55 + 2}, y{7 + static_cast<int>(i / 2) * 55 + 2};
+
+        /* Top left module of the finder pattern, after the quiet zone */
+        CHECK(pixels[(y + 2) * width + x + 2] == 0 and pixels[(y + 3) * width + x + 3] == 0);
+        CHECK(pixels[(y + 1) * width + x + 1] == 255 and pixels[(y + 2) * width + x + 1] == 255);
+
+        dark += countDark(QrCode{data[i], Ecl::L}, options.scale);
+    }
+
+    /* Margins, spacing, & the empty fourth cell stay light, the symbols hold every dark pixel */
+    CHECK(static_cast<size_t>(count(pixels.begin(), pixels.end(), 0)) == dark);
+    CHECK(static_cast<size_t>(count(pixels.begin(), pixels.end(), 255)) == pixels.size() - dark);
+
+    /* Colors that are not gray make a BGR sheet */
+    const RenderOptions colored{.scale = 2, .border_width = 1,
+                                .light_color = {255, 255, 0}, .dark_color = {0, 0, 128}};
+    const LabelSheet bgr{data, layout, colored};
+    const vector<uint8_t>& bgr_pixels{bgr.getPixels()};
+    const size_t corner{((7 + 2 + 2) * static_cast<size_t>(width) + 7 + 2 + 2) * 3};
+
+    CHECK(bgr.getChannels() == 3 and bgr_pixels.size() == pixels.size() * 3);
+    CHECK(bgr_pixels[0] == 255 and bgr_pixels[1] == 255 and bgr_pixels[2] == 0);
+    CHECK(bgr_pixels[corner] == 0 and bgr_pixels[corner + 1] == 0 and bgr_pixels[corner + 2] == 128);
+
+    /* Gray colors keep 1 channel */
+    const LabelSheet gray{data, layout, RenderOptions{.scale = 2, .border_width = 1, .dark_color = {64, 64, 64}}};
+
+    CHECK(gray.getChannels() == 1 and gray.getPixels()[corner / 3] == 64);
+
+    /* Symbols larger than their cells & invalid layouts are rejected */
+    CHECK_THROWS(LabelSheet(data, SheetLayout{.columns = 2, .cell_size = 45}, options), invalid_argument);
+    CHECK_THROWS(LabelSheet(data, SheetLayout{.columns = 0}, options), invalid_argument);
+    CHECK_THROWS(LabelSheet(data, layout, RenderOptions{.scale = 0}), invalid_argument);
+
+    /* Without data the sheet is its light margins & empty columns */
+    const LabelSheet empty{vector<wstring>{}, layout, options};
+
+    CHECK(empty.getWidth() == width and empty.getHeight() == 14);
+    CHECK(empty.getPixels() == vector<uint8_t>(width * 14, 255));
+    CHECK(not empty.render(ImageFormat::PNG).empty());
+
+    /* PNG & PPM only, saved files hold the rendered bytes, failures to create or write them are reported */
+    const string path{"LabelSheetTest.ppm"};
+
+    CHECK_THROWS(sheet.render(ImageFormat::SVG), domain_error);
+    CHECK_THROWS(sheet.save("LabelSheetTest.bmp"), invalid_argument);
+
+    sheet.save(path);
+
+    ifstream file{path, ios::binary};
+
+    CHECK(vector<uint8_t>(istreambuf_iterator<char>{file}, istreambuf_iterator<char>{})
+          == sheet.render(ImageFormat::PPM));
+    file.close();
+    filesystem::remove(path);
+
+    CHECK_THROWS(sheet.save("missing_directory/" + path), invalid_argument);
+
+    if (filesystem::exists("/dev/full")) {
+        const string full{"LabelSheetTest_full.png"};
+
+        filesystem::remove(full);
+        filesystem::create_symlink("/dev/full", full);
+        CHECK_THROWS(sheet.save(full), domain_error);
+        filesystem::remove(full);
+    }
+
+    return Tests::report();
+}
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "Qrio/DataAnalyzer.h"
+#include "Qrio/Encoder.h"
+#include "Qrio/ErrorCorrectionEncoder.h"
+#include "Qrio/Structurer.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    int symbols{0};
+    double regret_sum{0};
+
+    for (int version{1}; version <= 12; version++) {
+        for (Ecl ecl: {Ecl::L, Ecl::M, Ecl::Q, Ecl::H}) {
+            for (int k{0}; k < 3; k++) {
+                wstring payload{};
+
+                for (int i{0}; i < 10 + k * 7 + version; i++) {
+                    payload += static_cast<wchar_t>(L'a' + (i * 7 + k * 3 + version) % 26);
+                }
+
+                /* Payloads too long for the smallest versions are skipped */
+                optional<Encoder> encoder{};
+
+                try {
+                    encoder.emplace(DataAnalyzer{payload, version, ecl});
+                } catch (const domain_error&) {
+                    continue;
+                }
+
+                const ErrorCorrectionEncoder ec_encoder{*encoder};
+                Structurer exact{ec_encoder, -1, MaskPolicy::EXACT}, fast{ec_encoder, -1, MaskPolicy::FAST};
+                long best{-1};
+
+                for (int mask{0}; mask < 8; mask++) {
+                    Structurer fixed{ec_encoder, mask};
+                    const long penalty{fixed.getMaskPenalty()};
+
+                    best = best < 0 ? penalty : min(best, penalty);
+                }
+
+                /* EXACT scores all 8 masks, FAST may give up some penalty but still picks a valid mask */
+                const long exact_penalty{exact.getMaskPenalty()}, fast_penalty{fast.getMaskPenalty()};
+
+                CHECK(exact_penalty == best);
+                CHECK(0 <= fast.final_mask and fast.final_mask < 8);
+                CHECK(exact_penalty <= fast_penalty);
+
+                symbols++;
+                regret_sum += static_cast<double>(fast_penalty - exact_penalty) / static_cast<double>(exact_penalty);
+            }
+        }
+    }
+
+    /* On average, the mask chosen by FAST is within 15% of the best penalty */
+    CHECK(symbols > 100);
+    CHECK(regret_sum / symbols < 0.15);
+
+    return Tests::report();
+}
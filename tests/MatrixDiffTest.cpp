@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/DataAnalyzer.h"
+#include "Qrio/Encoder.h"
+#include "Qrio/ErrorCorrectionEncoder.h"
+#include "Qrio/MatrixDiff.h"
+#include "Qrio/QrCode.h"
+#include "Qrio/Structurer.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Region,
+ *      left column, top row, width & height.
+ *
+ * Post-Conditions:
+ *      Returns true if the region is the given rectangle.
+ */
+static bool isRegion(const DirtyRegion& region, int x, int y, int width, int height) {
+    return region.x == x and region.y == y and region.width == width and region.height == height;
+}
+
+/*
+ * Pre-Conditions:
+ *      Previous matrix,
+ *      next matrix of the same size,
+ *      regions of their differences,
+ *      gap the regions were built with.
+ *
+ * Post-Conditions:
+ *      Returns true if the regions lie in the matrix, are disjoint, in top to bottom
+ *      then left to right order, & cover every changed module (only those without gap).
+ */
+static bool isCover(const SquareMatrix& previous, const SquareMatrix& next, const vector<DirtyRegion>& regions,
+                    int gap) {
+    const int n{static_cast<int>(next.size())};
+    vector<int> covered(next.size() * next.size(), 0);
+
+    for (size_t i{0}; i < regions.size(); i++) {
+        const DirtyRegion& region{regions[i]};
+
+        if (region.x < 0 or region.y < 0 or region.width < 1 or region.height < 1
+            or region.x + region.width > n or region.y + region.height > n) {
+            return false;
+        }
+
+        if (i > 0 and (regions[i - 1].y > region.y
+                       or (regions[i - 1].y == region.y and regions[i - 1].x >= region.x))) {
+            return false;
+        }
+
+        for (int y{region.y}; y < region.y + region.height; y++) {
+            for (int x{region.x}; x < region.x + region.width; x++) {
+                covered[static_cast<size_t>(y * n + x)]++;
+            }
+        }
+    }
+
+    for (int y{0}; y < n; y++) {
+        for (int x{0}; x < n; x++) {
+            const int count{covered[static_cast<size_t>(y * n + x)]};
+            const bool changed{previous.module(x, y) != next.module(x, y)};
+
+            if (count > 1 or (changed and count == 0) or (gap == 0 and not changed and count != 0)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+int main() {
+    const SquareMatrix blank{21};
+
+    CHECK(MatrixDiff::getRegions(blank, blank).empty());
+    CHECK(MatrixDiff::getChangedCount(blank, blank) == 0);
+
+    /* Row runs, bridged when the gap allows it (written as [row][column]) */
+    SquareMatrix next{blank};
+
+    next[0][3] = true;
+    next[1][2] = true;
+    next[1][3] = true;
+    next[1][6] = true;
+    CHECK(MatrixDiff::getChangedCount(blank, next) == 4);
+
+    vector<DirtyRegion> regions{MatrixDiff::getRegions(blank, next)};
+
+    CHECK(regions.size() == 3);
+    CHECK(isRegion(regions[0], 3, 0, 1, 1));
+    CHECK(isRegion(regions[1], 2, 1, 2, 1));
+    CHECK(isRegion(regions[2], 6, 1, 1, 1));
+    CHECK(MatrixDiff::getRegions(blank, next, 1).size() == 3);
+
+    regions = MatrixDiff::getRegions(blank, next, 2);
+    CHECK(regions.size() == 2);
+    CHECK(isRegion(regions[1], 2, 1, 5, 1));
+
+    /* Runs spanning the same columns grow the rectangle above, others start a new one */
+    next = blank;
+
+    for (int y{2}; y < 5; y++) {
+        for (int x{5}; x < 8; x++) {
+            next[y][x] = true;
+        }
+    }
+
+    next[5][5] = true;
+    next[5][6] = true;
+    next[20][20] = true;
+
+    regions = MatrixDiff::getRegions(blank, next);
+    CHECK(regions.size() == 3);
+    CHECK(isRegion(regions[0], 5, 2, 3, 3));
+    CHECK(isRegion(regions[1], 5, 5, 2, 1));
+    CHECK(isRegion(regions[2], 20, 20, 1, 1));
+
+    /* Changes are differences: clearing modules counts as much as setting them */
+    regions = MatrixDiff::getRegions(next, blank);
+    CHECK(regions.size() == 3 and isRegion(regions[0], 5, 2, 3, 3));
+
+    /* Random differences are covered exactly once */
+    uint32_t state{12345};
+
+    for (int round{0}; round < 50; round++) {
+        SquareMatrix previous{blank};
+
+        next = blank;
+
+        for (size_t y{0}; y < blank.size(); y++) {
+            for (size_t x{0}; x < blank.size(); x++) {
+                state = state * 1664525 + 1013904223;
+                previous[y][x] = (state >> 31) != 0;
+                state = state * 1664525 + 1013904223;
+                next[y][x] = (state >> 28) < static_cast<uint32_t>(round % 8) ? not previous[y][x] : previous[y][x];
+            }
+        }
+
+        for (int gap{0}; gap < 4; gap++) {
+            CHECK(isCover(previous, next, MatrixDiff::getRegions(previous, next, gap), gap));
+        }
+    }
+
+    CHECK_THROWS(static_cast<void>(MatrixDiff::getRegions(blank, SquareMatrix{25})), invalid_argument);
+    CHECK_THROWS(static_cast<void>(MatrixDiff::getChangedCount(blank, SquareMatrix{25})), invalid_argument);
+    CHECK_THROWS(static_cast<void>(MatrixDiff::getRegions(blank, blank, -1)), invalid_argument);
+
+    /* Dirty regions of QR codes are the module regions in image pixels, past the border */
+    const QrCode first{"Partial refresh 1", Ecl::M, Designator::TERMINATOR, 2};
+    const QrCode second{QrCode::fromPrevious(first, "Partial refresh 2")};
+    RenderOptions options{};
+
+    options.scale = 3;
+    options.border_width = 4;
+
+    for (int gap{0}; gap < 3; gap++) {
+        const vector<DirtyRegion> modules{MatrixDiff::getRegions(first.getMatrix(), second.getMatrix(), gap)};
+        const vector<DirtyRegion> pixels{second.getDirtyRegions(first, options, gap)};
+
+        CHECK(not modules.empty() and pixels.size() == modules.size());
+
+        for (size_t i{0}; i < pixels.size() and i < modules.size(); i++) {
+            CHECK(isRegion(pixels[i], (modules[i].x + 4) * 3, (modules[i].y + 4) * 3,
+                           modules[i].width * 3, modules[i].height * 3));
+        }
+    }
+
+    CHECK(second.getDirtyRegions(second, options).empty());
+
+    /*
+     * Following a previous symbol never changes more modules than the best penalty mask does,
+     * & the penalty of the chosen mask stays within 1/4 (Structurer::PENALTY_SLACK) of the best one
+     */
+    for (int k{2}; k < 12; k++) {
+        const wstring text{L"Partial refresh " + to_wstring(k)};
+        const QrCode following{QrCode::fromPrevious(first, text)};
+        const QrCode plain{text, Ecl::M, Designator::TERMINATOR, 2};
+        const QrCode same_mask{text, Ecl::M, Designator::TERMINATOR, 2, following.getMask()};
+
+        CHECK(following.getVersion() == 2 and following.getEcl() == Ecl::M);
+        CHECK(MatrixDiff::getChangedCount(first.getMatrix(), following.getMatrix())
+              <= MatrixDiff::getChangedCount(first.getMatrix(), plain.getMatrix()));
+        CHECK(MatrixDiff::getChangedCount(same_mask.getMatrix(), following.getMatrix()) == 0);
+
+        const ErrorCorrectionEncoder ec_encoder{Encoder{DataAnalyzer{text, 2, Ecl::M}}};
+        long best{-1};
+
+        for (int mask{0}; mask < 8; mask++) {
+            Structurer fixed{ec_encoder, mask};
+            const long penalty{fixed.getMaskPenalty()};
+
+            best = best < 0 ? penalty : min(best, penalty);
+        }
+
+        Structurer chosen{ec_encoder, following.getMask()};
+
+        CHECK(chosen.getMaskPenalty() <= best + best / 4);
+    }
+
+    const QrCode other{"Partial refresh 1", Ecl::M, Designator::TERMINATOR, 3};
+
+    CHECK_THROWS(static_cast<void>(second.getDirtyRegions(other, options)), invalid_argument);
+    const QrCode micro{QrCode::makeMicro("1")};
+
+    CHECK_THROWS(static_cast<void>(micro.getDirtyRegions(QrCode{"1", Ecl::L, Designator::TERMINATOR, 1})),
+                 invalid_argument);
+
+    options.scale = 0;
+    CHECK_THROWS(static_cast<void>(second.getDirtyRegions(first, options)), invalid_argument);
+
+    return Tests::report();
+}
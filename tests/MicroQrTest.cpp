@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Micro QR code.
+ *
+ * Post-Conditions:
+ *      Returns the 15 format bits, read from the column right of the finder pattern,
+ *      then the row below it, with the 0x4445 mask removed.
+ */
+int getFormatBits(const SquareMatrix& matrix) {
+    int bits{0};
+
+    for (int i{0}; i < 8; i++) {
+        bits |= matrix.at(i + 1, 8) << i;
+    }
+
+    for (int i{8}; i < 15; i++) {
+        bits |= matrix.at(8, 15 - i) << i;
+    }
+
+    return bits ^ 0x4445;
+}
+
+/*
+ * Pre-Conditions:
+ *      5 data bits of the format information.
+ *
+ * Post-Conditions:
+ *      Returns the data bits followed by their (15, 5) BCH code.
+ */
+int getFormatCode(int data) {
+    int rem{data};
+
+    for (int i{0}; i < 10; i++) {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    }
+
+    return data << 10 | rem;
+}
+
+
+int main() {
+    /* M2-L "01234567", the Micro QR encoding example of ISO/IEC 18004 Annex I */
+    const ErrorCorrectionEncoder example{Encoder{DataAnalyzer{L"01234567", 2, Ecl::L, Designator::TERMINATOR,
+                                                              {}, 0, -1, -1, -1, true}}};
+
+    CHECK(example.encoder.codewords == vector<int>({0x40, 0x18, 0xAC, 0xC3, 0x00}));
+    CHECK(static_cast<const vector<int>&>(example)
+          == vector<int>({0x40, 0x18, 0xAC, 0xC3, 0x00, 0x86, 0x0D, 0x22, 0xAE, 0x30}));
+
+    /* Symbol numbers of M1, M2-L, M2-M, M3-L, M3-M, M4-L, M4-M & M4-Q, Check Table 13 */
+    const vector<pair<int, Ecl>> symbols{{1, Ecl::L}, {2, Ecl::L}, {2, Ecl::M}, {3, Ecl::L},
+                                         {3, Ecl::M}, {4, Ecl::L}, {4, Ecl::M}, {4, Ecl::Q}};
+
+    for (int number{0}; number < static_cast<int>(symbols.size()); number++) {
+        const auto& [version, ecl]{symbols[number]};
+
+        for (int mask{0}; mask < 4; mask++) {
+            const QrCode code{QrCode::makeMicro("12345", ecl, Designator::TERMINATOR, version, mask)};
+            const SquareMatrix& matrix{code.getMatrix()};
+            const size_t size{matrix.size()};
+
+            CHECK(code.isMicro());
+            CHECK(code.getVersion() == version);
+            CHECK(code.getMask() == mask);
+            CHECK(size == static_cast<size_t>(9 + 2 * version));
+
+            /* Single finder pattern in the top left corner, within its separator */
+            for (size_t row{0}; row < 8; row++) {
+                for (size_t column{0}; column < 8; column++) {
+                    const size_t ring{max(row > 3 ? row - 3 : 3 - row, column > 3 ? column - 3 : 3 - column)};
+
+                    CHECK(matrix.at(row, column) == (ring != 2 and ring != 4));
+                }
+            }
+
+            /* Timing patterns along the top & left edges */
+            for (size_t i{8}; i < size; i++) {
+                CHECK(matrix.at(0, i) == (i % 2 == 0));
+                CHECK(matrix.at(i, 0) == (i % 2 == 0));
+            }
+
+            CHECK(getFormatBits(matrix) == getFormatCode(number << 2 | mask));
+        }
+    }
+
+    /* Automatic versions are the smallest that fit the mode */
+    CHECK(QrCode::makeMicro("12345").getVersion() == 1);
+    CHECK(QrCode::makeMicro("HELLO").getVersion() == 2);
+    CHECK(QrCode::makeMicro("hello").getVersion() == 3);
+
+    CHECK_THROWS(QrCode::makeMicro("12345", Ecl::H), invalid_argument);
+    CHECK_THROWS(QrCode::makeMicro("\\000026abc"), invalid_argument);
+    CHECK_THROWS(QrCode::makeMicro("ABC", Ecl::L, Designator::TERMINATOR, 1), length_error);
+    CHECK_THROWS(QrCode::makeMicro(string(40, 'a')), length_error);
+    CHECK_THROWS(QrCode::makeMicro("1", Ecl::L, Designator::TERMINATOR, -1, 4), domain_error);
+
+    return Tests::report();
+}
@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+#include "Qrio/OpenCvAdapter.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    const QrCode code{"01234567", Ecl::M, Designator::TERMINATOR, 1};
+    const RenderOptions options{.scale = 2, .border_width = 1,
+                                .light_color = {200, 220, 240}, .dark_color = {10, 20, 30}};
+    const int side{46};
+
+    /* cv::Mat pixels match the PPM of the BitmapWriter, which stores RGB */
+    const cv::Mat image{OpenCvAdapter::toMat(code, options)};
+    const vector<uint8_t> ppm{code.render(ImageFormat::PPM, options)};
+    const size_t header{string{"P6\n46 46\n255\n"}.size()};
+
+    CHECK(image.type() == CV_8UC3 and image.rows == side and image.cols == side);
+
+    for (int y{0}; y < side; y++) {
+        for (int x{0}; x < side; x++) {
+            const cv::Vec3b& pixel{image.at<cv::Vec3b>(y, x)};
+            const uint8_t* rgb{ppm.data() + header + (static_cast<size_t>(y) * side + x) * 3};
+
+            CHECK(pixel[0] == rgb[2] and pixel[1] == rgb[1] and pixel[2] == rgb[0]);
+        }
+    }
+
+    /* Drawing into a region of gray, BGR, & BGRA images, the rest is untouched */
+    const cv::Rect region{10, 5, side, side};
+
+    for (int type: {CV_8UC1, CV_8UC3, CV_8UC4}) {
+        cv::Mat canvas(60, 70, type, cv::Scalar::all(7)), expected{};
+
+        OpenCvAdapter::renderInto(code, canvas, region, options);
+
+        if (type == CV_8UC1) {
+            cv::cvtColor(image, expected, cv::COLOR_BGR2GRAY);
+        } else if (type == CV_8UC4) {
+            cv::cvtColor(image, expected, cv::COLOR_BGR2BGRA);
+        } else {
+            expected = image;
+        }
+
+        cv::Mat difference{};
+
+        cv::absdiff(canvas(region), expected, difference);
+        CHECK(cv::countNonZero(difference.reshape(1)) == 0);
+
+        canvas(region).setTo(cv::Scalar::all(7));
+
+        const cv::Mat changed{canvas.reshape(1) != 7};
+
+        CHECK(cv::countNonZero(changed) == 0);
+    }
+
+    /* JPEG through imencode, black on white survives the compression after a threshold */
+    const RenderOptions plain{.scale = 8};
+    const vector<uint8_t> jpeg{OpenCvAdapter::render(code, ImageFormat::JPEG, plain)};
+    const cv::Mat decoded{cv::imdecode(jpeg, cv::IMREAD_GRAYSCALE)};
+    cv::Mat gray{};
+
+    cv::cvtColor(OpenCvAdapter::toMat(code, plain), gray, cv::COLOR_BGR2GRAY);
+
+    CHECK(jpeg.size() > 2 and jpeg[0] == 0xFF and jpeg[1] == 0xD8);
+    CHECK(decoded.size() == gray.size());
+
+    const cv::Mat decoded_dark{decoded < 128}, dark{gray < 128};
+
+    CHECK(cv::countNonZero(decoded_dark != dark) == 0);
+
+    /* Motion JPEG video of a frame stream */
+    const vector<uint8_t> file(2000, 0x5A);
+    const FrameStream stream{file.data(), file.size(), FrameOptions{.chunk_size = 500}};
+    const string video{"OpenCvTest.avi"};
+
+    CHECK(OpenCvAdapter::saveVideo(stream, video, 10, plain).frames == stream.getFrameCount());
+    CHECK(filesystem::file_size(video) > 0);
+    filesystem::remove(video);
+
+    CHECK_THROWS(OpenCvAdapter::toMat(code, RenderOptions{.scale = 0}), invalid_argument);
+    CHECK_THROWS(OpenCvAdapter::toMat(code, RenderOptions{.border_width = -1}), invalid_argument);
+
+    return Tests::report();
+}
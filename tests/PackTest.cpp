@@ -0,0 +1,254 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Qrio/PackReader.h"
+#include "Qrio/PackWriter.h"
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Path of a file.
+ *
+ * Post-Conditions:
+ *      Returns the bytes of the file.
+ */
+static vector<uint8_t> readFile(const string& path) {
+    ifstream file{path, ios::binary};
+
+    return vector<uint8_t>{istreambuf_iterator<char>{file}, istreambuf_iterator<char>{}};
+}
+
+/*
+ * Pre-Conditions:
+ *      Path of a file,
+ *      bytes.
+ *
+ * Post-Conditions:
+ *      Replaces the file with the bytes.
+ */
+static void writeFile(const string& path, const vector<uint8_t>& bytes) {
+    ofstream file{path, ios::binary | ios::trunc};
+
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<streamsize>(bytes.size()));
+}
+
+/*
+ * Pre-Conditions:
+ *      Entry number.
+ *
+ * Post-Conditions:
+ *      Returns the key of the entry.
+ */
+static string getKey(size_t number) {
+    return "item-" + to_string(number);
+}
+
+/*
+ * Pre-Conditions:
+ *      Entry number.
+ *
+ * Post-Conditions:
+ *      Returns the QR code of the entry.
+ */
+static QrCode getCode(size_t number) {
+    return QrCode{"Pack entry " + to_string(number * 7919), Ecl::M};
+}
+
+/*
+ * Pre-Conditions:
+ *      Pack reader,
+ *      entry number.
+ *
+ * Post-Conditions:
+ *      Returns true if the entry of the key is found & holds the matrix of its QR code.
+ */
+static bool hasEntry(const PackReader& reader, size_t number) {
+    const PackReader::Entry entry{reader.find(getKey(number))};
+
+    return entry and entry.key == getKey(number) and entry.getRecord().matrix == getCode(number).getMatrix();
+}
+
+
+int main() {
+    const string path{"pack_test.qrpk"};
+    const RenderOptions options{};
+
+    /* Every third entry carries its PBM image, entry 5 is replaced by a later one */
+    {
+        PackWriter writer{path};
+
+        for (size_t i{0}; i < 100; i++) {
+            writer.add(getKey(i), getCode(i), i % 3 == 0 ? getCode(i).render(ImageFormat::PBM, options)
+                                                         : vector<uint8_t>{});
+        }
+
+        writer.add(getKey(5), getCode(500));
+        CHECK(writer.size() == 101);
+        writer.close();
+        CHECK_THROWS(writer.add("late", getCode(0)), domain_error);
+    }
+
+    /* Revision 2 layout: header, entries, entry table, hash table, footer */
+    const vector<uint8_t> bytes{readFile(path)};
+    const auto read{[&bytes](size_t offset, size_t size) {
+        uint64_t value{0};
+
+        for (size_t i{0}; i < size; i++) {
+            value |= static_cast<uint64_t>(bytes[offset + i]) << (8 * i);
+        }
+
+        return value;
+    }};
+    const size_t footer{bytes.size() - PackWriter::FOOTER_SIZE};
+
+    CHECK(Tests::toHex({bytes.begin(), bytes.begin() + PackWriter::HEADER_SIZE}) == "5152504b02000000");
+    CHECK(string(bytes.end() - 4, bytes.end()) == "QRPK");
+
+    const uint64_t table{read(footer, 8)};
+    const uint64_t slots{read(footer + 16, 8)};
+
+    CHECK(read(footer + 8, 8) == 101);
+    CHECK(slots == table + 101 * PackWriter::ENTRY_SIZE);
+    CHECK(footer == slots + 4 * read(footer + 24, 4));
+    CHECK(read(footer + 24, 4) >= 101);
+
+    /* The first entry follows the header: its sizes, then its key */
+    CHECK(read(PackWriter::HEADER_SIZE, 4) == getKey(0).size());
+    CHECK(string(bytes.begin() + PackWriter::HEADER_SIZE + PackWriter::PREFIX_SIZE,
+                 bytes.begin() + PackWriter::HEADER_SIZE + PackWriter::PREFIX_SIZE + getKey(0).size()) == getKey(0));
+    CHECK(read(table, 8) == PackWriter::getHash(getKey(0)));
+
+    /* Lookups find every key, the replaced one gives its latest entry */
+    {
+        const PackReader reader{path};
+
+        CHECK(reader.size() == 101);
+
+        for (size_t i{0}; i < 100; i++) {
+            if (i != 5) {
+                CHECK(hasEntry(reader, i));
+            }
+
+            CHECK(reader.getEntry(i).key == getKey(i));
+        }
+
+        const PackReader::Entry replaced{reader.find(getKey(5))};
+
+        CHECK(replaced.getRecord().matrix == getCode(500).getMatrix());
+        CHECK(replaced.image == nullptr and replaced.image_size == 0);
+
+        const vector<uint8_t> image{getCode(3).render(ImageFormat::PBM, options)};
+        const PackReader::Entry entry{reader.find(getKey(3))};
+
+        CHECK(vector<uint8_t>(entry.image, entry.image + entry.image_size) == image);
+        CHECK(not reader.find("missing"));
+        CHECK(not reader.find(""));
+    }
+
+    /* A pack left unclosed with a torn last entry keeps its whole entries */
+    {
+        PackWriter writer{path};
+
+        for (size_t i{0}; i < 10; i++) {
+            writer.add(getKey(i), getCode(i));
+        }
+
+        writer.flush();
+
+        vector<uint8_t> crashed{readFile(path)};
+
+        writer.close();
+        crashed.insert(crashed.end(), {9, 0, 0, 0, 200, 0, 0, 0, 0, 0, 0, 0, 'i', 't'});
+        writeFile(path, crashed);
+    }
+
+    CHECK_THROWS(PackReader{path}, invalid_argument);
+
+    {
+        PackWriter writer{path, MatrixEncoding::AUTO, true};
+
+        CHECK(writer.size() == 10);
+
+        for (size_t i{10}; i < 15; i++) {
+            writer.add(getKey(i), getCode(i));
+        }
+    }
+
+    {
+        const PackReader reader{path};
+
+        CHECK(reader.size() == 15);
+
+        for (size_t i{0}; i < 15; i++) {
+            CHECK(hasEntry(reader, i));
+        }
+    }
+
+    /* Appending to a closed pack drops its index, then rebuilds it */
+    {
+        PackWriter writer{path, MatrixEncoding::RUNS, true};
+
+        CHECK(writer.size() == 15);
+        writer.add(getKey(15), getCode(15));
+    }
+
+    {
+        const PackReader reader{path};
+
+        CHECK(reader.size() == 16);
+
+        for (size_t i{0}; i < 16; i++) {
+            CHECK(hasEntry(reader, i));
+        }
+    }
+
+    /* Other revisions & other files are rejected */
+    vector<uint8_t> old{readFile(path)};
+
+    old[4] = 1;
+    writeFile(path, old);
+    CHECK_THROWS(PackReader{path}, invalid_argument);
+    CHECK_THROWS(PackWriter(path, MatrixEncoding::AUTO, true), invalid_argument);
+
+    writeFile(path, Tests::toBytes("not a pack file, only some text"));
+    CHECK_THROWS(PackReader{path}, invalid_argument);
+    CHECK_THROWS(PackWriter(path, MatrixEncoding::AUTO, true), invalid_argument);
+
+    filesystem::remove(path);
+    CHECK_THROWS(PackReader{path}, invalid_argument);
+
+    return Tests::report();
+}
@@ -0,0 +1,223 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Qrio/PrinterWriter.h"
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Row major QR matrix,
+ *      scale in dots,
+ *      border width in modules.
+ *
+ * Post-Conditions:
+ *      Returns the packed dot rows (most significant bit first), a set bit prints a dot.
+ */
+vector<vector<uint8_t>> getRows(const SquareMatrix& matrix, size_t scale, size_t border) {
+    const size_t side{(matrix.size() + 2 * border) * scale};
+    vector<vector<uint8_t>> result(side, vector<uint8_t>((side + 7) / 8, 0));
+
+    for (size_t y{0}; y < side; y++) {
+        for (size_t x{0}; x < side; x++) {
+            const size_t row{y / scale}, column{x / scale};
+
+            if (border <= row and row < matrix.size() + border and border <= column
+                and column < matrix.size() + border and matrix.at(row - border, column - border)) {
+                result[y][x / 8] |= static_cast<uint8_t>(0x80 >> (x % 8));
+            }
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      ZPL ASCII compressed data,
+ *      hexadecimal digits per row.
+ *
+ * Post-Conditions:
+ *      Returns the expanded hexadecimal digits.
+ */
+string expandZpl(const string& data, size_t width) {
+    string result{}, row{};
+    size_t count{0};
+
+    const auto end_row{[&](char fill) {
+        row.resize(width, fill);
+        result += row;
+        row.clear();
+    }};
+
+    for (char c: data) {
+        if ('G' <= c and c <= 'Y') {
+            count += static_cast<size_t>(c - 'F');
+        } else if ('g' <= c and c <= 'z') {
+            count += static_cast<size_t>(c - 'f') * 20;
+        } else if (c == ',' or c == '!') {
+            end_row(c == ',' ? '0' : 'F');
+        } else if (c == ':') {
+            row = result.substr(result.size() - width);
+            end_row('0');
+        } else {
+            row.append(count == 0 ? 1 : count, c);
+            count = 0;
+
+            if (row.size() == width) {
+                end_row('0');
+            }
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      PCL raster data.
+ *
+ * Post-Conditions:
+ *      Returns the dot rows of the PackBits (mode 2) & empty delta (mode 3) transfers.
+ */
+vector<vector<uint8_t>> expandPcl(const vector<uint8_t>& pcl) {
+    vector<vector<uint8_t>> result{};
+    int mode{0};
+
+    for (size_t i{0}; i + 3 < pcl.size(); i++) {
+        if (pcl[i] != 0x1B or pcl[i + 1] != '*' or pcl[i + 2] != 'b') {
+            continue;
+        }
+
+        size_t end{i + 3}, value{0};
+
+        while (isdigit(pcl[end])) {
+            value = value * 10 + (pcl[end++] - '0');
+        }
+
+        if (pcl[end] == 'M') {
+            mode = static_cast<int>(value);
+        } else if (mode == 3 and value == 0) {
+            result.push_back(result.back());
+        } else if (mode == 2) {
+            vector<uint8_t> row{};
+
+            for (size_t k{end + 1}; k < end + 1 + value;) {
+                const auto n{static_cast<int8_t>(pcl[k++])};
+
+                if (n >= 0) {
+                    row.insert(row.end(), pcl.begin() + static_cast<long>(k), pcl.begin() + static_cast<long>(k) + n + 1);
+                    k += static_cast<size_t>(n) + 1;
+                } else {
+                    row.insert(row.end(), static_cast<size_t>(1 - n), pcl[k++]);
+                }
+            }
+
+            result.push_back(row);
+        }
+
+        i = end;
+    }
+
+    return result;
+}
+
+
+int main() {
+    /* M1 "12345", 11 x 11 modules with mask 2 */
+    const QrCode micro{QrCode::makeMicro("12345")};
+    const SquareMatrix& small{micro.getMatrix()};
+
+    CHECK(micro.getMask() == 2);
+
+    /* GS v 0, normal density, 2 bytes x 15 rows, then the rows */
+    CHECK(Tests::toHex(PrinterWriter::toEscPos(small, 1, 2))
+          == "1d76300002000f00000000003fa820b02ea02e802eb820983fa00018339814603c1800000000");
+
+    /* Blank rows end with ',', repeated rows are ':', runs of 3 'F' are 'IF' */
+    CHECK(PrinterWriter::toZpl(small, 2, 1)
+          == "^XA\n^FO0,0^GFA,104,104,4,,:3IF33,:30033C,:33F33,:33F3,:33F33F,:30030F,:3IF3,:K0F,:3C3F0F,:0CC0F,"
+             ":3FC00F,:,:^FS\n^XZ\n");
+    CHECK(PrinterWriter::toZpl(small, 1, 2, false)
+          == "^XA\n^FO0,0^GFA,30,30,2,000000003FA820B02EA02E802EB820983FA00018339814603C1800000000^FS\n^XZ\n");
+
+    /* Resolution, width, height, start, then per module row PackBits & an empty delta row */
+    CHECK(Tests::toHex(PrinterWriter::toPcl(small, 2, 1, 203))
+          == "1b2a74323033521b2a723236531b2a723236541b2a7231411b2a62324d1b2a623257fd001b2a62334d1b2a6230571b2a"
+             "62324d1b2a623557033fff33001b2a62334d1b2a6230571b2a62324d1b2a6235570330033c001b2a62334d1b2a623057"
+             "1b2a62324d1b2a6235570333f330001b2a62334d1b2a6230571b2a62324d1b2a6235570133f3ff001b2a62334d1b2a62"
+             "30571b2a62324d1b2a6235570333f33f001b2a62334d1b2a6230571b2a62324d1b2a6235570330030f001b2a62334d1b"
+             "2a6230571b2a62324d1b2a623557033fff30001b2a62334d1b2a6230571b2a62324d1b2a623557ff00010f001b2a6233"
+             "4d1b2a6230571b2a62324d1b2a623557033c3f0f001b2a62334d1b2a6230571b2a62324d1b2a623557030cc0f0001b2a"
+             "62334d1b2a6230571b2a62324d1b2a623557033fc00f001b2a62334d1b2a6230571b2a62324d1b2a623257fd001b2a62"
+             "334d1b2a6230571b2a7243");
+
+    /* Every format carries the dot rows of the matrix */
+    const QrCode code{"HELLO WORLD", Ecl::Q, Designator::TERMINATOR, 2};
+    const SquareMatrix& matrix{code.getMatrix()};
+
+    for (size_t scale: {1, 3, 8}) {
+        for (size_t border: {0, 4}) {
+            const vector<vector<uint8_t>> rows{getRows(matrix, scale, border)};
+            const size_t side{rows.size()}, stride{rows.front().size()};
+            const int s{static_cast<int>(scale)}, b{static_cast<int>(border)};
+
+            vector<uint8_t> escpos{0x1D, 'v', '0', 0, static_cast<uint8_t>(stride), 0,
+                                   static_cast<uint8_t>(side), static_cast<uint8_t>(side >> 8)};
+
+            for (const vector<uint8_t>& row: rows) {
+                escpos.insert(escpos.end(), row.begin(), row.end());
+            }
+
+            CHECK(PrinterWriter::toEscPos(matrix, s, b) == escpos);
+
+            const string total{to_string(stride * side)};
+            const string header{"^XA\n^FO0,0^GFA," + total + "," + total + "," + to_string(stride) + ","};
+            const string plain{PrinterWriter::toZpl(matrix, s, b, false)}, compressed{PrinterWriter::toZpl(matrix, s, b)};
+
+            /* ZPL holds the rows as upper case digits */
+            const string hex{Tests::toHex({escpos.begin() + 8, escpos.end()}, true)};
+
+            CHECK(plain == header + hex + "^FS\n^XZ\n");
+            CHECK(compressed.rfind(header, 0) == 0);
+            CHECK(expandZpl(compressed.substr(header.size(), compressed.size() - header.size() - 8), 2 * stride)
+                  == hex);
+            CHECK(compressed.size() < plain.size());
+
+            CHECK(expandPcl(PrinterWriter::toPcl(matrix, s, b)) == rows);
+        }
+    }
+
+    CHECK_THROWS(PrinterWriter::toEscPos(small, 4000, 4), length_error);
+
+    return Tests::report();
+}
@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "Qrio/Profiler.h"
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Profile,
+ *      expected number of calls of each stage.
+ *
+ * Post-Conditions:
+ *      Returns true if every stage was recorded the expected number of times.
+ */
+bool hasCalls(const StageProfile& profile, const vector<uint64_t>& calls) {
+    for (size_t i{0}; i < STAGE_COUNT; i++) {
+        if (profile.calls[i] != calls[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Pre-Conditions:
+ *      Profile.
+ *
+ * Post-Conditions:
+ *      Returns true if every field of the profile is 0.
+ */
+bool isEmpty(const StageProfile& profile) {
+    return hasCalls(profile, vector<uint64_t>(STAGE_COUNT, 0)) and profile.getTotalSeconds() == 0
+           and profile.getTotalAllocations() == 0 and profile.getTotalBytes() == 0
+           and profile.getPeakBytes() == 0 and profile.probes == 0 and profile.symbols == 0;
+}
+
+
+int main() {
+    Profiler::reset();
+
+    /*
+     * Escapes are parsed twice (data & ECIs), then each construction stage runs once,
+     * the stages of the fitting checks are charged to the version search.
+     * The binary search probes the versions 20, 10, 5, 2 & 1, a preferred version is probed once.
+     */
+    const vector<uint64_t> construction{2, 1, 1, 1, 1, 1, 1, 0, 0};
+    const QrCode searched{"HELLO WORLD", Ecl::Q};
+    const QrCode preferred{"HELLO WORLD", Ecl::Q, Designator::TERMINATOR, 2};
+    const StageProfile first{searched.getProfile()}, second{preferred.getProfile()};
+
+    CHECK(hasCalls(first, construction) and hasCalls(second, construction));
+    CHECK(first.probes == 5 and second.probes == 1);
+    CHECK(first.symbols == 1 and second.symbols == 1);
+
+    /* Every profiling build counts the allocations, the version search allocates its trial encodings */
+    CHECK(first.allocations[static_cast<size_t>(Stage::VERSION_SEARCH)] > 0);
+    CHECK(first.getTotalAllocations() > 0 and first.getTotalBytes() >= first.getTotalAllocations());
+
+#ifdef QRIO_HEAP_PROFILING
+    CHECK(first.getPeakBytes() > 0 and Profiler::getPeakHeapSize() > 0);
+#endif
+
+    /* Rendering is only summed process-wide, the total holds at least the stages of both symbols */
+    static_cast<void>(searched.render());
+
+    StageProfile sum{first};
+
+    sum += second;
+
+    const StageProfile total{Profiler::getTotal()};
+
+    CHECK(searched.getProfile().calls == first.calls);
+    CHECK(total.calls[static_cast<size_t>(Stage::RENDERING)] == 1);
+    CHECK(total.probes == sum.probes and total.symbols == sum.symbols);
+
+    for (size_t i{0}; i < STAGE_COUNT; i++) {
+        CHECK(total.calls[i] >= sum.calls[i] and total.nanoseconds[i] >= sum.nanoseconds[i]);
+        CHECK(total.allocations[i] >= sum.allocations[i] and total.bytes[i] >= sum.bytes[i]);
+    }
+
+    CHECK(total.getTotalAllocations() >= sum.getTotalAllocations());
+
+    Profiler::reset();
+    CHECK(isEmpty(Profiler::getTotal()));
+
+    return Tests::report();
+}
@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Qrio/QrCache.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Entry number.
+ *
+ * Post-Conditions:
+ *      Returns the key of a version 1-M QR code, all keys have the same cost.
+ */
+static QrCache::Key getKey(int number) {
+    return QrCache::Key{"item-" + to_string(number % 10), Ecl::M, Designator::TERMINATOR, 1};
+}
+
+
+int main() {
+    /* Hits return the cached symbol itself, other options are other symbols */
+    {
+        QrCache cache{1 << 20, 4};
+        const auto first{cache.get(getKey(1))};
+        const auto second{cache.get(getKey(1))};
+
+        CHECK(first == second);
+        CHECK(first->getMatrix() == QrCode("item-1", Ecl::M, Designator::TERMINATOR, 1).getMatrix());
+        CHECK(cache.getHits() == 1 and cache.getMisses() == 1 and cache.size() == 1);
+
+        const auto other_ecl{cache.get(QrCache::Key{"item-1", Ecl::H, Designator::TERMINATOR, 1})};
+        const auto other_version{cache.get(QrCache::Key{"item-1", Ecl::M, Designator::TERMINATOR, 2})};
+
+        CHECK(other_ecl != first and other_ecl->getEcl() == Ecl::H);
+        CHECK(other_version != first and other_version->getVersion() == 2);
+        CHECK(cache.getHits() == 1 and cache.getMisses() == 3 and cache.size() == 3);
+
+        /* Rendered bytes are cached per rendering name, next to the symbol */
+        RenderOptions options{};
+
+        options.scale = 3;
+
+        const auto render{[&options](const QrCode& code) {
+            return code.render(ImageFormat::PNG, options);
+        }};
+        const auto png{cache.getRendered(getKey(1), "png:scale=3", render)};
+
+        CHECK(*png == first->render(ImageFormat::PNG, options));
+        CHECK(cache.getRendered(getKey(1), "png:scale=3", render) == png);
+        CHECK(cache.getRendered(getKey(1), "pbm", [](const QrCode& code) {
+            return code.render(ImageFormat::PBM, RenderOptions{});
+        }) != png);
+        CHECK(cache.size() == 5);
+
+        cache.clear();
+        CHECK(cache.size() == 0 and cache.getMemoryUsage() == 0);
+        CHECK(cache.get(getKey(1)) != first);
+    }
+
+    /* One shard, room for three entries: the least recently used one is evicted */
+    size_t cost{0};
+
+    {
+        QrCache cache{1 << 20, 1};
+
+        static_cast<void>(cache.get(getKey(1)));
+        cost = cache.getMemoryUsage();
+    }
+
+    CHECK(cost > 0);
+
+    {
+        const size_t budget{3 * cost + cost / 2};
+        QrCache cache{budget, 1};
+
+        for (int i{1}; i <= 3; i++) {
+            static_cast<void>(cache.get(getKey(i)));
+        }
+
+        CHECK(cache.size() == 3 and cache.getMemoryUsage() == 3 * cost);
+
+        /* Using 1 again leaves 2 as the least recently used */
+        static_cast<void>(cache.get(getKey(1)));
+        static_cast<void>(cache.get(getKey(4)));
+
+        CHECK(cache.getEvictions() == 1 and cache.size() == 3);
+        CHECK(cache.getMemoryUsage() <= budget);
+
+        const size_t misses{cache.getMisses()};
+
+        static_cast<void>(cache.get(getKey(1)));
+        static_cast<void>(cache.get(getKey(3)));
+        static_cast<void>(cache.get(getKey(4)));
+        CHECK(cache.getMisses() == misses);
+
+        static_cast<void>(cache.get(getKey(2)));
+        CHECK(cache.getMisses() == misses + 1 and cache.getEvictions() == 2);
+
+        for (int i{0}; i < 50; i++) {
+            static_cast<void>(cache.get(getKey(i)));
+            CHECK(cache.getMemoryUsage() <= budget and cache.size() <= 3);
+        }
+    }
+
+    /* Entries larger than a shard are served but never cached */
+    {
+        QrCache cache{cost / 2, 1};
+
+        CHECK(cache.get(getKey(1))->getMatrix() == cache.get(getKey(1))->getMatrix());
+        CHECK(cache.getMisses() == 2 and cache.size() == 0 and cache.getMemoryUsage() == 0);
+    }
+
+    /* Concurrent lookups of shared keys all get the right symbol */
+    {
+        QrCache cache{1 << 20, 4};
+        vector<vector<vector<bool>>> expected{};
+        vector<thread> threads{};
+        atomic<int> wrong{0};
+
+        for (int i{0}; i < 10; i++) {
+            expected.push_back(QrCode{"item-" + to_string(i), Ecl::M, Designator::TERMINATOR, 1}.getMatrix());
+        }
+
+        for (int t{0}; t < 8; t++) {
+            threads.emplace_back([&cache, &expected, &wrong, t]() {
+                for (int i{0}; i < 200; i++) {
+                    const int number{(i * 7 + t) % 10};
+
+                    if (cache.get(getKey(number))->getMatrix() != expected[static_cast<size_t>(number)]) {
+                        wrong++;
+                    }
+                }
+            });
+        }
+
+        for (thread& worker: threads) {
+            worker.join();
+        }
+
+        CHECK(wrong == 0);
+        CHECK(cache.getHits() + cache.getMisses() == 1600);
+        CHECK(cache.getMisses() >= 10 and cache.size() == 10);
+    }
+
+    CHECK_THROWS(QrCache(1 << 20, 0), invalid_argument);
+
+    return Tests::report();
+}
@@ -0,0 +1,83 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "Qrio/ShiftJis.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    /* Kanji, Hiragana, full width Latin & the Kanji of the ISO/IEC 18004 example, Check 7.4.6 */
+    CHECK(ShiftJis::fromUnicode(0x70B9) == 0x935F);
+    CHECK(ShiftJis::fromUnicode(0x8317) == 0xE4AA);
+    CHECK(ShiftJis::fromUnicode(0x3042) == 0x82A0);
+    CHECK(ShiftJis::fromUnicode(0xFF21) == 0x8260);
+    CHECK(ShiftJis::fromUnicode(0x20AC) == 0);
+    CHECK(ShiftJis::fromUnicode(0x1F600) == 0);
+    CHECK(not ShiftJis::isKanji('A'));
+
+    unordered_map<size_t, int> eci{};
+
+    /* Characters of Shift JIS are replaced by their codes, without ECI */
+    CHECK(DataAnalyzer::fromUnicode(L"点茗", eci) == wstring({0x935F, 0xE4AA}));
+    CHECK(eci.empty());
+    CHECK(DataAnalyzer::fromUnicode(L"café あ", eci) == wstring({'c', 'a', 'f', 0xE9, ' ', 0x82A0}));
+    CHECK(eci.empty());
+
+    /* Any other character beyond Latin-1 turns the rest into UTF-8 under ECI 26 */
+    CHECK(DataAnalyzer::fromUnicode(L"é点€", eci)
+          == wstring({0xC3, 0xA9, 0x935F, 0xE2, 0x82, 0xAC}));
+    CHECK(eci == (unordered_map<size_t, int>{{0, DataAnalyzer::UTF8_ECI}}));
+
+    /* UTF-16 surrogate pairs are combined, lone surrogates are rejected */
+    eci.clear();
+    CHECK(DataAnalyzer::fromUnicode(wstring({'a', 0xD83D, 0xDE00}), eci) == wstring({'a', 0xF0, 0x9F, 0x98, 0x80}));
+    CHECK_THROWS(DataAnalyzer::fromUnicode(wstring({0xDC00}), eci), invalid_argument);
+
+    /* 1-M "点茗": 1000 00000010 0110110011111 1101010101010 0000, then the pad codewords */
+    const Encoder encoder{DataAnalyzer{wstring({0x935F, 0xE4AA}), 1, Ecl::M}};
+
+    CHECK(encoder.codewords == vector<int>({0x80, 0x26, 0xCF, 0xEA, 0xA8, 0x00, 0xEC, 0x11,
+                                            0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11}));
+
+    /* Unicode input gives the same symbol as the Shift JIS codes */
+    const QrCode unicode{QrCode::fromUnicode(L"点茗", Ecl::M)};
+    const QrCode shift_jis{wstring({0x935F, 0xE4AA}), Ecl::M};
+
+    CHECK(unicode.getVersion() == 1);
+    CHECK(unicode.getMatrix() == shift_jis.getMatrix());
+
+    /* 13 bits per Kanji against 16 bits in byte mode: 48 Kanji fill version 4-L, Check Table 7 */
+    CHECK(QrCode::fromUnicode(wstring(48, L'あ')).getVersion() == 4);
+    CHECK(QrCode::fromUnicode(wstring(49, L'あ')).getVersion() == 5);
+
+    return Tests::report();
+}
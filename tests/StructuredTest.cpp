@@ -0,0 +1,93 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+int main() {
+    /* UTF-8 text under ECI 26 (UTF-8), long enough for several version 2 parts */
+    wstring text{};
+
+    for (int i{0}; i < 30; i++) {
+        text += L"Ã©tÃ© ";
+    }
+
+    const wstring utf8{L"\\000026" + text};
+    const vector<wstring> parts{QrCode::splitData(utf8, Ecl::M, 2)};
+
+    CHECK(parts.size() > 1);
+    CHECK(parts.front().rfind(L"\\000026", 0) == 0);
+
+    wstring joined{parts.front()};
+
+    for (size_t i{1}; i < parts.size(); i++) {
+        /* Every later part starts with the ECI, so it decodes as UTF-8 on its own */
+        CHECK(parts[i].rfind(L"\\000026", 0) == 0);
+        joined += parts[i].substr(7);
+    }
+
+    CHECK(joined == utf8);
+
+    /* The ECI only applies from the escape on, doubled 0x5C values are never split */
+    const wstring mixed{wstring(80, L'a') + L"\\\\" + wstring(40, L'b') + L"\\000020" + wstring(200, L'c')};
+    const vector<wstring> mixed_parts{QrCode::splitData(mixed, Ecl::L, 3)};
+    bool after_eci{false};
+
+    joined.clear();
+
+    for (const wstring& part: mixed_parts) {
+        const bool repeated{after_eci and part.rfind(L"\\000020", 0) == 0};
+
+        CHECK(after_eci == repeated);
+        const size_t backslashes{part.size() - 1 - part.find_last_not_of(L'\\')};
+
+        CHECK(backslashes % 2 == 0);
+
+        joined += repeated ? part.substr(7) : part;
+        after_eci = after_eci or part.find(L"\\000020") != wstring::npos;
+    }
+
+    CHECK(joined == mixed);
+
+    /* The symbols are the parts generated together */
+    const vector<QrCode> symbols{QrCode::splitStructured(utf8, Ecl::M, 2)};
+    const vector<QrCode> expected{QrCode::makeStructured(parts, Ecl::M)};
+
+    CHECK(symbols.size() == expected.size());
+
+    for (size_t i{0}; i < symbols.size() and i < expected.size(); i++) {
+        CHECK(symbols[i].getVersion() <= 2);
+        CHECK(symbols[i].getMatrix() == expected[i].getMatrix());
+    }
+
+    CHECK_THROWS(QrCode::splitData(wstring(20'000, L'a'), Ecl::H, 1), length_error);
+
+    return Tests::report();
+}
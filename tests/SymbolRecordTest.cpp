@@ -0,0 +1,107 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "Qrio/SymbolRecord.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Record bytes.
+ *
+ * Post-Conditions:
+ *      Returns the record loaded from the bytes.
+ */
+SymbolRecord load(const vector<uint8_t>& bytes) {
+    return SymbolRecord{bytes.data(), bytes.size()};
+}
+
+
+int main() {
+    /* M1 "12345": 'Q' 'R', revision 1, flags (1 Micro, 2 runs), version, mask, ECL bits, side */
+    const SymbolRecord micro{QrCode::makeMicro("12345")};
+    const string packed{"515201010102010bfeb05aea5d0baf04ffa003ce6a33c180"};
+
+    CHECK(Tests::toHex(micro.toBytes(MatrixEncoding::PACKED)) == packed);
+    CHECK(Tests::toHex(micro.toBytes(MatrixEncoding::RUNS))
+          == "515201030102010b03000708010a01030001060108020400010203060108010300010203060104000102030601080303"
+             "000106010902020007080101090203000204030902030101030107020200040902");
+    CHECK(Tests::toHex(micro.toBytes()) == packed);
+
+    /* Both encodings load back to the same symbol, for QR & Micro QR codes */
+    vector<QrCode> codes{};
+
+    codes.push_back(QrCode::makeMicro("12345"));
+    codes.push_back(QrCode::makeMicro("HELLO", Ecl::M));
+    codes.push_back(QrCode::makeMicro("hello", Ecl::Q));
+    codes.emplace_back("01234567", Ecl::M, Designator::TERMINATOR, 1);
+    codes.emplace_back("Symbol records", Ecl::H, Designator::TERMINATOR, 7, 5);
+    codes.emplace_back(wstring(2000, L'A'), Ecl::L, Designator::TERMINATOR, 40);
+
+    for (const QrCode& code: codes) {
+        const SymbolRecord record{code};
+
+        for (MatrixEncoding encoding: {MatrixEncoding::AUTO, MatrixEncoding::PACKED, MatrixEncoding::RUNS}) {
+            const SymbolRecord loaded{load(record.toBytes(encoding))};
+
+            CHECK(loaded.version == code.getVersion() and loaded.mask == code.getMask());
+            CHECK(loaded.ecl == code.getEcl() and loaded.micro == code.isMicro());
+            CHECK(loaded.matrix == code.getMatrix());
+        }
+
+        CHECK(record.toBytes().size() == min(record.toBytes(MatrixEncoding::PACKED).size(),
+                                             record.toBytes(MatrixEncoding::RUNS).size()));
+        CHECK(SymbolRecord::fromRuns(SymbolRecord::getRuns(code.getMatrix())) == code.getMatrix());
+    }
+
+    /* Invalid magic, revision, flags, version, side, sizes & runs */
+    const vector<uint8_t> valid{micro.toBytes(MatrixEncoding::RUNS)};
+
+    for (size_t index: {0, 2, 3, 4, 7}) {
+        vector<uint8_t> bytes{valid};
+
+        bytes[index] ^= 0x40;
+        CHECK_THROWS(load(bytes), invalid_argument);
+    }
+
+    vector<uint8_t> truncated{valid.begin(), valid.end() - 1}, trailing{valid}, outside{valid};
+
+    trailing.push_back(0);
+    outside[9] = 10;
+
+    CHECK_THROWS(load(truncated), invalid_argument);
+    CHECK_THROWS(load(trailing), invalid_argument);
+    CHECK_THROWS(load(outside), invalid_argument);
+    CHECK_THROWS(load(vector<uint8_t>(valid.begin(), valid.begin() + 7)), invalid_argument);
+    CHECK_THROWS(SymbolRecord::fromRuns(RunList{{{1, 1}}, {{0, 3}}}), invalid_argument);
+
+    return Tests::report();
+}
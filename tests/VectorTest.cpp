@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ * Copyright (c) 2023 Yolo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Qrio/QrCode.h"
+#include "Qrio/VectorWriter.h"
+#include "tests/Check.h"
+
+using namespace std;
+using namespace Qrio;
+
+
+/*
+ * Pre-Conditions:
+ *      Side of the symbol with its border,
+ *      border width,
+ *      rectangles (x, y, width, height) in modules, y pointing down.
+ *
+ * Post-Conditions:
+ *      Returns the matrix covered by the rectangles, without the border.
+ */
+SquareMatrix fill(size_t side, size_t border, const vector<vector<size_t>>& rectangles) {
+    SquareMatrix result{side - 2 * border};
+
+    for (const vector<size_t>& r: rectangles) {
+        for (size_t y{r[1]}; y < r[1] + r[3]; y++) {
+            for (size_t x{r[0]}; x < r[0] + r[2]; x++) {
+                result[y - border][x - border] = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Pre-Conditions:
+ *      PostScript or PDF content,
+ *      operator of the rectangles,
+ *      side of the symbol with its border.
+ *
+ * Post-Conditions:
+ *      Returns the "x y width height operator" rectangles, with y pointing down.
+ */
+vector<vector<size_t>> getRectangles(const string& content, const string& name, size_t side) {
+    vector<vector<size_t>> result{};
+    istringstream lines{content};
+    string line{};
+
+    while (getline(lines, line)) {
+        istringstream fields{line};
+        size_t x, y, width, height;
+        string op{};
+
+        if (fields >> x >> y >> width >> height >> op and op == name and width != side) {
+            result.push_back({x, side - y - height, width, height});
+        }
+    }
+
+    return result;
+}
+
+
+int main() {
+    const QrCode code{"01234567", Ecl::M, Designator::TERMINATOR, 1};
+    const SquareMatrix& matrix{code.getMatrix()};
+    const size_t border{4}, side{matrix.size() + 2 * border};
+
+    /* SVG path "MX,YhWvHh-Wz" per rectangle */
+    const string svg{VectorWriter::toSvg(matrix)};
+    const size_t path{svg.find(" d=\"") + 4};
+    vector<vector<size_t>> rectangles{};
+    istringstream commands{svg.substr(path, svg.find('"', path) - path)};
+    char m, comma, h, v, h_back, minus, z;
+    size_t x, y, width, height, width_back;
+
+    while (commands >> m >> x >> comma >> y >> h >> width >> v >> height >> h_back >> minus >> width_back >> z) {
+        CHECK(m == 'M' and comma == ',' and h == 'h' and v == 'v' and h_back == 'h' and minus == '-' and z == 'z');
+        CHECK(width_back == width);
+        rectangles.push_back({x, y, width, height});
+    }
+
+    CHECK(fill(side, border, rectangles) == matrix);
+    CHECK(svg.find("viewBox=\"0 0 29 29\"") != string::npos);
+
+    /* Sizes are in fixed point, without exponents or trailing zeros */
+    CHECK(VectorWriter::toSvg(matrix, 4, 0.5).find("width=\"14.5\"") != string::npos);
+    CHECK(VectorWriter::toSvg(matrix, 4, 1e6).find("width=\"29000000\"") != string::npos);
+    CHECK(VectorWriter::toSvg(matrix, 4, 1e-7).find("width=\"0.000003\"") != string::npos);
+    CHECK(VectorWriter::toSvg(matrix, 0, 1, 0x123456, 0xABCDEF).find("fill=\"#ABCDEF\"") != string::npos);
+
+    /* EPS rectangles with y pointing up, after the light background */
+    const string eps{VectorWriter::toEps(matrix, 4, 1e6)};
+
+    CHECK(fill(side, border, getRectangles(eps, "R", side)) == matrix);
+    CHECK(eps.find("%%BoundingBox: 0 0 29000000 29000000\n") != string::npos);
+    CHECK(eps.find("1000000 1000000 scale\n") != string::npos);
+    CHECK(eps.find("e+") == string::npos);
+
+    /* PDF cross-reference entries of 20 bytes point at their objects, after the free entry */
+    const string pdf{VectorWriter::toPdf(matrix, 4, 2.5, 0xFFFFFF, 0x336699)};
+
+    CHECK(fill(side, border, getRectangles(pdf, "re", side)) == matrix);
+    CHECK(pdf.find("/MediaBox [0 0 72.5 72.5]") != string::npos);
+    CHECK(pdf.find("0.2 0.4 0.6 rg\n") != string::npos);
+
+    const size_t xref{static_cast<size_t>(stoul(pdf.substr(pdf.rfind("startxref\n") + 10)))};
+
+    CHECK(pdf.compare(xref, 5, "xref\n") == 0);
+
+    for (size_t object{1}; object <= 4; object++) {
+        const size_t offset{stoul(pdf.substr(xref + 9 + 20 * object, 10))};
+
+        CHECK(pdf.compare(offset, 7, to_string(object) + " 0 obj") == 0);
+    }
+
+    return Tests::report();
+}